@@ -0,0 +1,226 @@
+#ifndef BOOST_REAL_BALL_HPP
+#define BOOST_REAL_BALL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <real/exact_number.hpp>
+#include <real/interval.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief boost::real::magnitude is a low precision, non negative, upper bound of a number,
+         * mantissa * 2^exponent with a mantissa of at most 32 bits. Every operation rounds up, so the
+         * result is always an upper bound of the exact result.
+         */
+        struct magnitude {
+            std::uint64_t mantissa = 0;
+            long exponent = 0;
+
+            static constexpr std::uint64_t MAXIMUM_MANTISSA = std::uint64_t(1) << 32;
+
+            magnitude() = default;
+
+            magnitude(std::uint64_t m, long e) : mantissa(m), exponent(e) {
+                normalize();
+            }
+
+            /// keeps the mantissa under 32 bits, rounding up the dropped bits
+            void normalize() {
+                while (mantissa >= MAXIMUM_MANTISSA) {
+                    mantissa = (mantissa >> 1) + (mantissa & 1);
+                    exponent++;
+                }
+            }
+
+            bool is_zero() const {
+                return mantissa == 0;
+            }
+
+            magnitude operator+(const magnitude& other) const {
+                if (this->is_zero()) {
+                    return other;
+                }
+                if (other.is_zero()) {
+                    return *this;
+                }
+
+                const magnitude& big = (this->exponent >= other.exponent) ? *this : other;
+                const magnitude& small = (this->exponent >= other.exponent) ? other : *this;
+                long shift = big.exponent - small.exponent;
+
+                // the small mantissa is aligned to the big exponent, rounding it up
+                std::uint64_t aligned;
+                if (shift >= 32) {
+                    aligned = 1;
+                } else {
+                    aligned = (small.mantissa >> shift) + ((small.mantissa & ((std::uint64_t(1) << shift) - 1)) != 0);
+                }
+                return magnitude(big.mantissa + aligned, big.exponent);
+            }
+
+            magnitude operator*(const magnitude& other) const {
+                if (this->is_zero() || other.is_zero()) {
+                    return magnitude();
+                }
+                return magnitude(this->mantissa * other.mantissa, this->exponent + other.exponent);
+            }
+        };
+
+        /**
+         * @brief boost::real::ball is the midpoint-radius representation of an approximation of a
+         * number: the set [midpoint - radius, midpoint + radius].
+         *
+         * @details The midpoint is a full precision boost::real::exact_number while the radius is a
+         * boost::real::magnitude that fits in a machine word. The ball operations compute the
+         * midpoint once, with full precision, and bound the error of the result with cheap word
+         * arithmetic on the radii, where the interval operations compute both bounds in full precision.
+         * The price is a slightly wider enclosure, as the radius is rounded up at each step.
+         */
+        template <typename T = int>
+        struct ball {
+            exact_number<T> midpoint;
+            magnitude radius;
+
+            /// the radix of the digits of exact_number<T>
+            static constexpr std::uint64_t BASE = (std::numeric_limits<T>::max() / 4) * 2 - 1;
+
+            /// number of bits of BASE, so that BASE < 2^LIMB_BITS
+            static constexpr long LIMB_BITS = []() {
+                long bits = 0;
+                for (std::uint64_t b = BASE; b != 0; b >>= 1) {
+                    bits++;
+                }
+                return bits;
+            }();
+
+            ball() = default;
+
+            ball(const exact_number<T>& m, const magnitude& r) : midpoint(m), radius(r) {};
+
+            /// a ball containing the interval i, centered at its lower bound
+            explicit ball(const interval<T>& i) : midpoint(i.lower_bound), radius(magnitude_of(i.upper_bound - i.lower_bound)) {};
+
+            /// an upper bound of BASE^n, as a magnitude
+            static magnitude base_power(long n) {
+                // 2^LIMB_BITS - 3 <= BASE < 2^LIMB_BITS, so BASE^-n < 2^(-LIMB_BITS * n + 1) as long
+                // as -n is far below 2^LIMB_BITS / 5, which holds for any realistic precision
+                return magnitude(1, (n >= 0) ? LIMB_BITS * n : LIMB_BITS * n + 1);
+            }
+
+            /// an upper bound of |x|, as a magnitude
+            static magnitude magnitude_of(const exact_number<T>& x) {
+                size_t first = 0;
+                while (first < x.digits.size() && x.digits[first] == 0) {
+                    first++;
+                }
+                if (first == x.digits.size()) {
+                    return magnitude();
+                }
+                // |x| < (d + 1) * BASE^(exponent - 1), with d the first nonzero digit
+                long exponent = (long) x.exponent - (long) first - 1;
+                return magnitude((std::uint64_t) x.digits[first] + 1, 0) * base_power(exponent);
+            }
+
+            /// the exact integer n as an exact_number
+            static exact_number<T> exact_integer(std::uint64_t n) {
+                std::vector<T> digits;
+                while (n != 0) {
+                    digits.insert(digits.begin(), (T) (n % BASE));
+                    n /= BASE;
+                }
+                if (digits.empty()) {
+                    digits.push_back(0);
+                }
+                exact_number<T> result(digits, true);
+                result.normalize();
+                return result;
+            }
+
+            /// 2^n, n >= 0, as an exact_number
+            static exact_number<T> exact_power_of_two(long n) {
+                exact_number<T> result = exact_integer(1);
+                while (n > 0) {
+                    long step = std::min(n, LIMB_BITS - 1); // 2^step is a single digit
+                    result = result * exact_integer(std::uint64_t(1) << step);
+                    n -= step;
+                }
+                return result;
+            }
+
+            /// an exact_number upper bound of the magnitude r
+            static exact_number<T> upper_bound_of(const magnitude& r) {
+                if (r.is_zero()) {
+                    return exact_integer(0);
+                }
+                if (r.exponent >= 0) {
+                    return exact_integer(r.mantissa) * exact_power_of_two(r.exponent);
+                }
+
+                // 2^-k = 2^-s * 2^(-LIMB_BITS * q) < 2^(LIMB_BITS - s) * BASE^-(q + 1), with k = LIMB_BITS * q + s
+                long k = -r.exponent;
+                long q = k / LIMB_BITS;
+                long s = k % LIMB_BITS;
+                exact_number<T> result = exact_integer(r.mantissa) * exact_power_of_two(LIMB_BITS - s);
+                result.exponent -= (int) (q + 1);
+                return result;
+            }
+
+            /// the rounding error of truncating x to precision digits
+            static magnitude truncation_error(const exact_number<T>& x, size_t precision) {
+                if (x.digits.size() <= precision) {
+                    return magnitude();
+                }
+                return base_power((long) x.exponent - (long) precision);
+            }
+
+            /// the approximation interval [midpoint - radius, midpoint + radius]
+            interval<T> as_interval() const {
+                exact_number<T> r = upper_bound_of(radius);
+                interval<T> result;
+                result.lower_bound = midpoint - r;
+                result.upper_bound = midpoint + r;
+                result.lower_bound.normalize();
+                result.upper_bound.normalize();
+                return result;
+            }
+        };
+
+        /// (m1 ± r1) + (m2 ± r2) = (m1 + m2) ± (r1 + r2), plus the rounding of the midpoint
+        template <typename T>
+        ball<T> ball_add(const ball<T>& lhs, const ball<T>& rhs, size_t precision) {
+            exact_number<T> sum = lhs.midpoint + rhs.midpoint;
+            sum.normalize();
+            magnitude error = lhs.radius + rhs.radius + ball<T>::truncation_error(sum, precision);
+            return ball<T>(sum.up_to(precision, false), error);
+        }
+
+        /// (m1 ± r1) - (m2 ± r2) = (m1 - m2) ± (r1 + r2), plus the rounding of the midpoint
+        template <typename T>
+        ball<T> ball_subtract(const ball<T>& lhs, const ball<T>& rhs, size_t precision) {
+            exact_number<T> difference = lhs.midpoint - rhs.midpoint;
+            difference.normalize();
+            magnitude error = lhs.radius + rhs.radius + ball<T>::truncation_error(difference, precision);
+            return ball<T>(difference.up_to(precision, false), error);
+        }
+
+        /// (m1 ± r1) * (m2 ± r2) = m1 * m2 ± (|m1| r2 + |m2| r1 + r1 r2), plus the rounding of the midpoint
+        template <typename T>
+        ball<T> ball_multiply(const ball<T>& lhs, const ball<T>& rhs, size_t precision) {
+            exact_number<T> product = lhs.midpoint * rhs.midpoint;
+            product.normalize();
+            magnitude error = ball<T>::magnitude_of(lhs.midpoint) * rhs.radius
+                            + ball<T>::magnitude_of(rhs.midpoint) * lhs.radius
+                            + lhs.radius * rhs.radius
+                            + ball<T>::truncation_error(product, precision);
+            return ball<T>(product.up_to(precision, false), error);
+        }
+    }
+}
+
+#endif // BOOST_REAL_BALL_HPP
@@ -0,0 +1,180 @@
+#ifndef BOOST_REAL_BINARY_SPLITTING_HPP
+#define BOOST_REAL_BINARY_SPLITTING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <real/real_exception.hpp>
+#include <real/exact_number.hpp>
+
+namespace boost {
+    namespace real {
+
+        /// the integer n as an exact_number<T>
+        template <typename T>
+        exact_number<T> integer_exact(long long n) {
+            static const T base = (std::numeric_limits<T>::max() / 4) * 2;
+            exact_number<T> result;
+            result.positive = n >= 0;
+
+            unsigned long long magnitude = (n < 0) ? -(unsigned long long)n : (unsigned long long)n;
+            while (magnitude > 0) {
+                result.digits.insert(result.digits.begin(), (T)(magnitude % base));
+                magnitude /= base;
+            }
+            result.exponent = result.digits.size();
+            if (result.digits.empty()) {
+                result.positive = true;
+            }
+            return result;
+        }
+
+        /**
+         * @brief x as a fraction of integers, numerator / denominator, with a positive denominator
+         * that is a power of the base.
+         */
+        template <typename T>
+        std::pair<exact_number<T>, exact_number<T>> as_fraction(const exact_number<T>& x) {
+            exact_number<T> numerator = x;
+            numerator.exponent = numerator.digits.size();
+
+            int fractional_digits = (int)x.digits.size() - x.exponent;
+            if (fractional_digits <= 0) {
+                return {x, integer_exact<T>(1)};
+            }
+            return {numerator, exact_number<T>(std::vector<T> {1}, fractional_digits + 1, true)};
+        }
+
+        /// an approximation of log2|x|, good enough to estimate the number of terms of a series
+        template <typename T>
+        double log2_estimate(const exact_number<T>& x) {
+            static const double base = (double)((std::numeric_limits<T>::max() / 4) * 2);
+            size_t first = 0;
+            while (first < x.digits.size() && x.digits[first] == 0) {
+                ++first;
+            }
+            if (first == x.digits.size()) {
+                return -std::numeric_limits<double>::infinity();
+            }
+
+            double leading = (double)x.digits[first];
+            if (first + 1 < x.digits.size()) {
+                leading += (double)x.digits[first + 1] / base;
+            }
+            return std::log2(leading) + (double)(x.exponent - 1 - (int)first) * std::log2(base);
+        }
+
+        /**
+         * @brief the products and the sum of a range of terms of a series, see binary_splitting.
+         */
+        template <typename T>
+        struct split_terms {
+            exact_number<T> p; // p(a) * ... * p(b - 1)
+            exact_number<T> q; // q(a) * ... * q(b - 1)
+            exact_number<T> t; // q * (the sum of the terms a to b - 1)
+        };
+
+        /**
+         * @brief the terms a to c - 1, from the terms a to b - 1 and b to c - 1.
+         */
+        template <typename T>
+        split_terms<T> join(const split_terms<T>& left, const split_terms<T>& right) {
+            return {left.p * right.p, left.q * right.q, left.t * right.q + left.p * right.t};
+        }
+
+        /**
+         * @brief Sums the terms a to b - 1 of a series whose n-th term is
+         * c(n) * (p(a) * ... * p(n)) / (q(a) * ... * q(n)), where p, q and c are integers.
+         *
+         * @details The range is split in halves, each half is summed as a single fraction, and the
+         * two fractions are combined with t = t_left * q_right + p_left * t_right. All the arithmetic
+         * is on integers, with the large products at the top of the tree where the fast
+         * multiplication pays off, and the sum is left as the fraction t / q, so that it can be
+         * divided once at the end, see split_sum. This is the usual way of evaluating hypergeometric
+         * series, like the ones of e, π or exp and sin of rational numbers, in near linear time.
+         *
+         * @param a, b - the range of terms to sum, a < b.
+         * @param p, q, c - callables taking the index of a term and returning an exact_number<T>
+         * integer.
+         */
+        template <typename T, typename P, typename Q, typename C>
+        split_terms<T> binary_splitting(size_t a, size_t b, const P& p, const Q& q, const C& c) {
+            if (b - a == 1) {
+                split_terms<T> leaf{p(a), q(a), {}};
+                leaf.t = c(a) * leaf.p;
+                return leaf;
+            }
+
+            size_t middle = a + (b - a) / 2;
+            return join(binary_splitting<T>(a, middle, p, q, c), binary_splitting<T>(middle, b, p, q, c));
+        }
+
+        /**
+         * @brief A series whose split terms are kept, so that summing more of its terms only splits
+         * the new ones and joins them to the kept ones, instead of splitting the whole range again.
+         * Constants that are extended to more and more precision, like π or ln 2, are sums of
+         * these, see cached_constant.
+         */
+        template <typename T>
+        class resumable_series {
+        private:
+            std::function<exact_number<T>(size_t)> _p, _q, _c;
+            split_terms<T> _terms;
+            size_t _size = 0;
+
+        public:
+            /**
+             * @param p, q, c - the integers of the terms, as in binary_splitting.
+             */
+            resumable_series(std::function<exact_number<T>(size_t)> p, std::function<exact_number<T>(size_t)> q,
+                             std::function<exact_number<T>(size_t)> c)
+                    : _p(std::move(p)), _q(std::move(q)), _c(std::move(c)) {}
+
+            /**
+             * @brief the terms 0 to n - 1 split, or all the terms split so far if there are more.
+             */
+            const split_terms<T>& terms(size_t n) {
+                if (n > _size) {
+                    split_terms<T> next = binary_splitting<T>(_size, n, _p, _q, _c);
+                    _terms = (_size == 0) ? std::move(next) : join(_terms, next);
+                    _size = n;
+                }
+                return _terms;
+            }
+        };
+
+        /**
+         * @brief the sum t / q of terms split by binary_splitting.
+         *
+         * @param max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+         * @param upper: if true: error lies in [0, +epsilon]
+         *               else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+         */
+        template <typename T>
+        exact_number<T> split_sum(const split_terms<T>& terms, size_t max_error_exponent, bool upper) {
+            // divide_vector rounds the magnitude of the quotient, so the direction flips for negative sums,
+            // and bounds its error relative to the magnitude, so the digits of the integer part are added
+            bool positive = terms.t.positive == terms.q.positive;
+            bool round_up = positive ? upper : !upper;
+            size_t integer_digits = (size_t)std::max(terms.t.exponent - terms.q.exponent, 0);
+
+            // t and q have many more digits than the quotient needs, when many terms are summed. They
+            // are cut to the digits that count, rounded so that the quotient moves in the direction
+            // of the bound, which adds less than base^(-max_error_exponent - 1) to its error
+            size_t digits = max_error_exponent + integer_digits + 3;
+            exact_number<T> result = terms.t.abs().up_to(digits, round_up);
+            result.divide_vector(terms.q.abs().up_to(digits, !round_up), max_error_exponent + integer_digits + 1, round_up);
+            if (result != literals::zero_exact<T>) {
+                result.positive = positive;
+            }
+            return result;
+        }
+    }
+}
+
+#endif // BOOST_REAL_BINARY_SPLITTING_HPP
@@ -0,0 +1,341 @@
+#ifndef BOOST_REAL_COMPILED_REAL_HPP
+#define BOOST_REAL_COMPILED_REAL_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/interval_arithmetic.hpp>
+#include <real/ball.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief boost::real::compiled_real is a flattened form of the operation tree of a
+         * boost::real::real. The tree is linearized once, in post order, into a contiguous tape of
+         * instructions, each of them writing the approximation interval of its node to its own
+         * register slot. Running the tape at a given precision evaluates the whole expression
+         * without visiting variants, following shared_ptrs or creating iterators per node, and
+         * the same tape can be run again at other precisions or with other leaf values.
+         *
+         * @details The operations that only depend on the intervals of their operands (+, -, *, /,
+         * integer power, roots, exponent, logarithm, sin and cos) are compiled into instructions. Any other
+         * node, as well as explicit, algorithmic and rational numbers, becomes a leaf of the tape and
+         * is approximated through its own precision iterator. Shared subexpressions are compiled once.
+         *
+         * As the tape runs at a fixed precision, it does not iterate the operands of a division or a
+         * logarithm when their intervals are not tight enough. In that case the exception of the
+         * operation is thrown and the tape should be run at a higher precision.
+         */
+        template <typename T = int>
+        class compiled_real {
+        private:
+            struct instruction {
+                bool is_leaf;
+                OPERATION operation;
+                size_t lhs; // register of the left operand, or index of the leaf
+                size_t rhs; // register of the right operand
+            };
+
+            std::vector<instruction> _tape;
+            std::vector<interval<T>> _registers;
+            std::vector<ball<T>> _ball_registers;
+            std::vector<const_precision_iterator<T>> _leaves;
+            std::vector<exact_number<T>> _exponents; // integer exponents of INTEGER_POWER and degrees of NTH_ROOT, by register
+            size_t _maximum_precision;
+
+            static bool is_compiled(OPERATION op) {
+                switch (op) {
+                    case OPERATION::ADDITION:
+                    case OPERATION::SUBTRACTION:
+                    case OPERATION::MULTIPLICATION:
+                    case OPERATION::DIVISION:
+                    case OPERATION::INTEGER_POWER:
+                    case OPERATION::SQRT:
+                    case OPERATION::NTH_ROOT:
+                    case OPERATION::EXPONENT:
+                    case OPERATION::LOGARITHM:
+                    case OPERATION::SIN:
+                    case OPERATION::COS:
+                    case OPERATION::ATAN:
+                    case OPERATION::ASIN:
+                    case OPERATION::ACOS:
+                    case OPERATION::SINH:
+                    case OPERATION::COSH:
+                    case OPERATION::TANH:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            size_t emit(instruction ins) {
+                _tape.push_back(ins);
+                _registers.emplace_back();
+                _ball_registers.emplace_back();
+                _exponents.emplace_back();
+                return _tape.size() - 1;
+            }
+
+            size_t compile(const std::shared_ptr<real_data<T>>& node,
+                           std::unordered_map<const real_data<T>*, size_t>& compiled) {
+                auto it = compiled.find(node.get());
+                if (it != compiled.end()) {
+                    return it->second;
+                }
+
+                size_t slot;
+                auto op_ptr = std::get_if<real_operation<T>>(node->get_real_ptr());
+
+                if (op_ptr != nullptr && is_compiled(op_ptr->get_operation())) {
+                    if (op_ptr->get_operation() == OPERATION::INTEGER_POWER || op_ptr->get_operation() == OPERATION::NTH_ROOT) {
+                        // the exponent is fixed, so it is evaluated once here instead of at each run
+                        auto exponent_itr = op_ptr->rhs()->get_precision_itr().cbegin();
+                        exponent_itr.iterate_n_times(exponent_itr.maximum_precision());
+                        if (!exponent_itr.get_interval().is_a_number()) {
+                            throw non_integral_exponent_exception();
+                        }
+
+                        size_t lhs = compile(op_ptr->lhs(), compiled);
+                        slot = emit({false, op_ptr->get_operation(), lhs, lhs});
+                        _exponents[slot] = exponent_itr.get_interval().upper_bound;
+                    } else {
+                        size_t lhs = compile(op_ptr->lhs(), compiled);
+                        size_t rhs = compile(op_ptr->rhs(), compiled);
+                        slot = emit({false, op_ptr->get_operation(), lhs, rhs});
+                    }
+                } else {
+                    _leaves.push_back(node->get_precision_itr().cbegin());
+                    slot = emit({true, OPERATION::ADDITION, _leaves.size() - 1, 0});
+                }
+
+                compiled[node.get()] = slot;
+                return slot;
+            }
+
+        public:
+            /**
+             * @brief compiles the operation tree of number into a tape.
+             *
+             * @param number - the boost::real::real number to compile.
+             */
+            explicit compiled_real(const real<T>& number) : _maximum_precision(number.maximum_precision()) {
+                std::unordered_map<const real_data<T>*, size_t> compiled;
+                compile(number._real_p, compiled);
+            }
+
+            /// number of instructions of the tape
+            size_t size() const {
+                return _tape.size();
+            }
+
+            /// number of leaves of the tape, in the order they are found in a post order walk of the tree
+            size_t leaves() const {
+                return _leaves.size();
+            }
+
+            size_t maximum_precision() const {
+                return _maximum_precision;
+            }
+
+            /**
+             * @brief replaces the n-th leaf of the tape with another number, keeping the rest of the tape.
+             *
+             * @param n - the index of the leaf to replace.
+             * @param value - the new value of the leaf.
+             */
+            void set_leaf(size_t n, const real<T>& value) {
+                _leaves.at(n) = value.get_real_itr().cbegin();
+            }
+
+            /**
+             * @brief runs the tape at the given precision.
+             *
+             * @param precision - the precision the leaves are approximated to and the operations rounded at.
+             * @return the approximation interval of the compiled number at that precision.
+             *
+             * @throws boost::real::divergent_division_result_exception if a divisor interval contains zero.
+             * @throws boost::real::logarithm_not_defined_for_non_positive_number if a logarithm operand
+             * interval is not positive.
+             * @throws boost::real::arcsine_not_defined_outside_unit_interval if an arcsine or arccosine
+             * operand interval has no point in [-1, 1].
+             */
+            const interval<T>& evaluate(size_t precision) {
+                for (size_t i = 0; i < _tape.size(); i++) {
+                    const instruction& ins = _tape[i];
+
+                    if (ins.is_leaf) {
+                        const_precision_iterator<T>& leaf = _leaves[ins.lhs];
+                        if (leaf.get_precision() < precision) {
+                            leaf.iterate_n_times(precision - leaf.get_precision());
+                        }
+                        _registers[i] = leaf.get_interval();
+                        continue;
+                    }
+
+                    const interval<T>& lhs = _registers[ins.lhs];
+                    const interval<T>& rhs = _registers[ins.rhs];
+
+                    switch (ins.operation) {
+                        case OPERATION::ADDITION:
+                            _registers[i] = interval_add(lhs, rhs, precision);
+                            break;
+                        case OPERATION::SUBTRACTION:
+                            _registers[i] = interval_subtract(lhs, rhs, precision);
+                            break;
+                        case OPERATION::MULTIPLICATION:
+                            _registers[i] = interval_multiply(lhs, rhs, precision);
+                            break;
+                        case OPERATION::DIVISION:
+                            _registers[i] = interval_divide(lhs, rhs, precision);
+                            break;
+                        case OPERATION::INTEGER_POWER:
+                            _registers[i] = interval_power(lhs, _exponents[i]);
+                            break;
+                        case OPERATION::SQRT:
+                            _registers[i] = interval_square_root(lhs, precision);
+                            break;
+                        case OPERATION::NTH_ROOT:
+                            _registers[i] = interval_root(lhs, _exponents[i], precision);
+                            break;
+                        case OPERATION::EXPONENT:
+                            _registers[i] = interval_exponent(lhs, precision);
+                            break;
+                        case OPERATION::LOGARITHM:
+                            _registers[i] = interval_logarithm(lhs, precision);
+                            break;
+                        case OPERATION::SIN:
+                            _registers[i] = interval_sine(lhs, precision);
+                            break;
+                        case OPERATION::COS:
+                            _registers[i] = interval_cosine(lhs, precision);
+                            break;
+                        case OPERATION::ATAN:
+                            _registers[i] = interval_arctangent(lhs, precision);
+                            break;
+                        case OPERATION::ASIN:
+                            _registers[i] = interval_arcsine(lhs, precision);
+                            break;
+                        case OPERATION::ACOS:
+                            _registers[i] = interval_arccosine(lhs, precision);
+                            break;
+                        case OPERATION::SINH:
+                            _registers[i] = interval_hyperbolic_sine(lhs, precision);
+                            break;
+                        case OPERATION::COSH:
+                            _registers[i] = interval_hyperbolic_cosine(lhs, precision);
+                            break;
+                        case OPERATION::TANH:
+                            _registers[i] = interval_hyperbolic_tangent(lhs, precision);
+                            break;
+                        default:
+                            throw boost::real::none_operation_exception();
+                    }
+                }
+
+                return _registers.back();
+            }
+
+            /// runs the tape at the maximum precision
+            const interval<T>& evaluate() {
+                return evaluate(_maximum_precision);
+            }
+
+            /**
+             * @brief runs the tape at the given precision in midpoint-radius form.
+             *
+             * @details additions, subtractions and multiplications compute a full precision midpoint
+             * and a machine word radius, see boost::real::ball. The other operations go through their
+             * interval kernels, converting their operands to intervals and their result back to a ball.
+             *
+             * @param precision - the precision the leaves are approximated to and the midpoints rounded at.
+             * @return a ball enclosing the compiled number.
+             *
+             * @throws boost::real::divergent_division_result_exception if a divisor interval contains zero.
+             * @throws boost::real::logarithm_not_defined_for_non_positive_number if a logarithm operand
+             * interval is not positive.
+             * @throws boost::real::arcsine_not_defined_outside_unit_interval if an arcsine or arccosine
+             * operand interval has no point in [-1, 1].
+             */
+            const ball<T>& evaluate_ball(size_t precision) {
+                for (size_t i = 0; i < _tape.size(); i++) {
+                    const instruction& ins = _tape[i];
+
+                    if (ins.is_leaf) {
+                        const_precision_iterator<T>& leaf = _leaves[ins.lhs];
+                        if (leaf.get_precision() < precision) {
+                            leaf.iterate_n_times(precision - leaf.get_precision());
+                        }
+                        _ball_registers[i] = ball<T>(leaf.get_interval());
+                        continue;
+                    }
+
+                    const ball<T>& lhs = _ball_registers[ins.lhs];
+                    const ball<T>& rhs = _ball_registers[ins.rhs];
+
+                    switch (ins.operation) {
+                        case OPERATION::ADDITION:
+                            _ball_registers[i] = ball_add(lhs, rhs, precision);
+                            break;
+                        case OPERATION::SUBTRACTION:
+                            _ball_registers[i] = ball_subtract(lhs, rhs, precision);
+                            break;
+                        case OPERATION::MULTIPLICATION:
+                            _ball_registers[i] = ball_multiply(lhs, rhs, precision);
+                            break;
+                        case OPERATION::DIVISION:
+                            _ball_registers[i] = ball<T>(interval_divide(lhs.as_interval(), rhs.as_interval(), precision));
+                            break;
+                        case OPERATION::INTEGER_POWER:
+                            _ball_registers[i] = ball<T>(interval_power(lhs.as_interval(), _exponents[i]));
+                            break;
+                        case OPERATION::SQRT:
+                            _ball_registers[i] = ball<T>(interval_square_root(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::NTH_ROOT:
+                            _ball_registers[i] = ball<T>(interval_root(lhs.as_interval(), _exponents[i], precision));
+                            break;
+                        case OPERATION::EXPONENT:
+                            _ball_registers[i] = ball<T>(interval_exponent(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::LOGARITHM:
+                            _ball_registers[i] = ball<T>(interval_logarithm(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::SIN:
+                            _ball_registers[i] = ball<T>(interval_sine(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::COS:
+                            _ball_registers[i] = ball<T>(interval_cosine(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::ATAN:
+                            _ball_registers[i] = ball<T>(interval_arctangent(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::ASIN:
+                            _ball_registers[i] = ball<T>(interval_arcsine(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::ACOS:
+                            _ball_registers[i] = ball<T>(interval_arccosine(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::SINH:
+                            _ball_registers[i] = ball<T>(interval_hyperbolic_sine(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::COSH:
+                            _ball_registers[i] = ball<T>(interval_hyperbolic_cosine(lhs.as_interval(), precision));
+                            break;
+                        case OPERATION::TANH:
+                            _ball_registers[i] = ball<T>(interval_hyperbolic_tangent(lhs.as_interval(), precision));
+                            break;
+                        default:
+                            throw boost::real::none_operation_exception();
+                    }
+                }
+
+                return _ball_registers.back();
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_COMPILED_REAL_HPP
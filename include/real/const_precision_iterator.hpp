@@ -6,9 +6,11 @@
 #include <real/real_algorithm.hpp>
 #include <real/real_operation.hpp>
 #include <real/exact_number.hpp>
+#include <real/real_math.hpp>
 #include <real/real_exception.hpp>
 #include <real/integer_number.hpp>
 #include <real/real_rational.hpp>
+#include <real/evaluation_context.hpp>
 #include <limits>
 #include <memory>
 #include <variant>
@@ -70,6 +72,9 @@ namespace boost {
 
                 interval<T> _approximation_interval;
 
+                /// sin and cos of the operand's bounds, for the tan, cot, sec and cosec nodes
+                sin_cos_cache<T> _sin_cos;
+
                 void check_and_swap_boundaries() {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this] (real_explicit<T>& real) { 
@@ -100,16 +105,22 @@ namespace boost {
                  * given by the user, or some default value.
                  *
                  * @details The user may set the maximum precision for any specific precision iterator.
-                 * They may also set a general maximum precision (the static optional value).
-                 * Preference is given: _maximum_precision > maximum_precision > DEFAULT_MAXIMUM_PRECISION
+                 * They may also set a maximum precision for the current thread (see evaluation_context),
+                 * or a general maximum precision (the static optional value).
+                 * Preference is given: _maximum_precision > evaluation_context::current() >
+                 * global_maximum_precision > DEFAULT_MAXIMUM_PRECISION
                  */
                 precision_t maximum_precision() const {
-                    if((_maximum_precision == 0) && !(global_maximum_precision))
-                        return DEFAULT_MAXIMUM_PRECISION;
-                    else if (_maximum_precision == 0)
+                    if (_maximum_precision != 0)
+                        return _maximum_precision;
+
+                    const evaluation_context* context = evaluation_context::current();
+                    if (context != nullptr && context->maximum_precision)
+                        return context->maximum_precision.value();
+                    else if (global_maximum_precision)
                         return global_maximum_precision.value();
                     else
-                        return _maximum_precision;
+                        return DEFAULT_MAXIMUM_PRECISION;
                 }
 
                 void set_maximum_precision(precision_t maximum_precision) {
@@ -134,10 +145,20 @@ namespace boost {
                 // fwd decl'd. Definition found in real_data.hpp
                 void update_operation_boundaries(real_operation<T> &ro);
 
+                // fwd decl'd. Definition found in real_data.hpp
+                std::tuple<exact_number<T>, exact_number<T>, exact_number<T>, exact_number<T>>
+                trigonometric_bounds(real_operation<T> &ro, bool divides_by_sine);
+
                 /**
                  * @brief Constructor for the least precise precision iterator
                  */ 
-                explicit const_precision_iterator(real_number<T> * a) : _real_ptr(std::make_shared<real_number<T>>(*a)), _precision(1) {
+                explicit const_precision_iterator(real_number<T> * a) : const_precision_iterator(std::make_shared<real_number<T>>(*a)) {};
+
+                /**
+                 * @brief Constructor for the least precise precision iterator of a number shared with
+                 * its owner (the real_data node), without copying it.
+                 */
+                explicit const_precision_iterator(std::shared_ptr<real_number<T>>  a) : _real_ptr(a), _precision(1) {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this] (real_explicit<T>& real) {
                             T base = (std::numeric_limits<T>::max() /4)*2 - 1;
@@ -184,7 +205,6 @@ namespace boost {
                             update_operation_boundaries(real);
                             // _maximum_precision = std::max(real.get_lhs_itr().maximum_precision(), real.get_rhs_itr().maximum_precision());
                             },
-
                         [this] (real_rational<T> &real){
                             if(real.b == integer_number<T>("1")){
                                 real_number<T> tmp_num = real_number<T>(real_explicit<T>(real.a));
@@ -198,60 +218,6 @@ namespace boost {
 
                             }
                         },
-                        
-                        [] (auto& real) {
-                            throw boost::real::bad_variant_access_exception();
-                            }
-                    }, *_real_ptr);
-                }
-
-                explicit const_precision_iterator(std::shared_ptr<real_number<T>>  a) : _real_ptr(a), _precision(1) {
-                    std::visit( overloaded { // perform operation on whatever is held in variant
-                        [this] (real_explicit<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
-                            this->_approximation_interval.lower_bound.exponent = real.exponent();
-                            this->_approximation_interval.upper_bound.exponent = real.exponent();
-                            this->_approximation_interval.lower_bound.positive = real.positive();
-                            this->_approximation_interval.upper_bound.positive = real.positive();
-
-                            T first_digit = real.digits()[0];
-                            this->_approximation_interval.lower_bound.digits.push_back(first_digit);
-
-                            if (first_digit == base) {
-                                this->_approximation_interval.upper_bound.digits.push_back(1);
-                                this->_approximation_interval.upper_bound.exponent++;
-                            } else if (this->_precision < real.digits().size()) {
-                                this->_approximation_interval.upper_bound.digits.push_back(first_digit + 1);
-                            } else {
-                                this->_approximation_interval.upper_bound.digits.push_back(first_digit);
-                            }
-                            this->check_and_swap_boundaries();
-                        },
-
-                        [this] (real_algorithm<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
-                            this->_approximation_interval.lower_bound.exponent = real.exponent();
-                            this->_approximation_interval.upper_bound.exponent = real.exponent();
-                            this->_approximation_interval.lower_bound.positive = real.positive();
-                            this->_approximation_interval.upper_bound.positive = real.positive();
-
-                            T first_digit = real[0];
-                            this->_approximation_interval.lower_bound.digits.push_back(first_digit);
-
-                            if (first_digit == base) {
-                                this->_approximation_interval.upper_bound.digits.push_back(1);
-                                this->_approximation_interval.upper_bound.exponent++;
-                            } else {
-                                this->_approximation_interval.upper_bound.digits.push_back(first_digit + 1);
-                            }
-                            this->check_and_swap_boundaries();
-                        },
-
-                        [this] (real_operation<T>& real) {
-                            // we don't need to init operands here - they *SHOULD* already be at cbegin or >
-                            update_operation_boundaries(real);
-                            // _maximum_precision = std::max(real.get_lhs_itr().maximum_precision(), real.get_rhs_itr().maximum_precision());
-                            },
                         [] (auto& real) {
                             throw boost::real::bad_variant_access_exception();
                             }
@@ -264,7 +230,7 @@ namespace boost {
                 /**
                  * @brief Constructor for maximum_precision precision iterator, from real_number
                  */
-                explicit const_precision_iterator(real_number<T> * a, bool cend) : _real_ptr(a) {
+                explicit const_precision_iterator(std::shared_ptr<real_number<T>> a, bool cend) : _real_ptr(a) {
                     if (cend) {
                         std::visit( overloaded { // perform operation on whatever is held in variant
                             [this, &a] (real_explicit<T>& real) {
@@ -301,14 +267,29 @@ namespace boost {
                  * @return a boost::real::const_precision_iterator of the number.
                  */
                 const_precision_iterator cend() {
-                    this->iterate_n_times(this->maximum_precision() - this->_precision);
+                    // the iterator may already be at (or past) the maximum precision, e.g. if it is
+                    // the node's iterator and the number was printed before
+                    if (this->_precision < this->maximum_precision()) {
+                        this->iterate_n_times(this->maximum_precision() - this->_precision);
+                    }
                     return *this;
                 }
 
+                /// as cend(), with the maximum precision of context, unless the iterator sets its own
+                const_precision_iterator cend(const evaluation_context& context) {
+                    evaluation_context::scope scope(context);
+                    return this->cend();
+                }
+
                 interval<T> get_interval() const {
                     return _approximation_interval;
                 }
 
+                /// the precision of the current approximation interval
+                precision_t get_precision() const {
+                    return _precision;
+                }
+
                 // fwd decl, defined in real_data.hpp
                 void operation_iterate(real_operation<T> &ro);
                 void operation_iterate_n_times(real_operation<T> &ro, int n);
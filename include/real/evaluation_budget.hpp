@@ -0,0 +1,43 @@
+#ifndef BOOST_REAL_EVALUATION_BUDGET_HPP
+#define BOOST_REAL_EVALUATION_BUDGET_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+namespace boost {
+    namespace real {
+
+        /// whether a budgeted evaluation reached its goal, or ran out of budget first
+        enum class BUDGET_STATUS{DECIDED, UNDECIDED};
+
+        /**
+         * @brief boost::real::evaluation_budget bounds the work of a single evaluation or comparison
+         * of numbers, see real::evaluate and real::compare.
+         *
+         * @details Each limit is optional, and the evaluation stops at the first one reached: the
+         * wall time since the evaluation started, the number of refinements of the approximation
+         * intervals, or the size in limbs of the bounds of the intervals. The work of a refinement
+         * grows with the size of the bounds, so the last two limits together bound the number of limb
+         * operations. The limits are checked between refinements, so an evaluation may exceed its
+         * time by the duration of one of them.
+         */
+        struct evaluation_budget {
+            std::optional<std::chrono::steady_clock::duration> time;
+            std::optional<size_t> refinements;
+            std::optional<size_t> limbs;
+
+            /**
+             * @brief whether an evaluation started at start, that made refinements refinements and
+             * reached bounds of limbs limbs, has to stop.
+             */
+            bool exhausted(std::chrono::steady_clock::time_point start, size_t refinements, size_t limbs) const {
+                return (this->refinements && refinements >= *this->refinements) ||
+                       (this->limbs && limbs >= *this->limbs) ||
+                       (this->time && std::chrono::steady_clock::now() - start >= *this->time);
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_EVALUATION_BUDGET_HPP
@@ -0,0 +1,94 @@
+#ifndef BOOST_REAL_EVALUATION_CONTEXT_HPP
+#define BOOST_REAL_EVALUATION_CONTEXT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include <real/work_stealing_pool.hpp>
+
+namespace boost {
+    namespace real {
+
+        /// how many precision steps each refinement of a comparison takes, see evaluation_context
+        enum class REFINEMENT{LINEAR, DOUBLING};
+
+        /**
+         * @brief boost::real::evaluation_context holds the settings of the evaluation of numbers: the
+         * maximum precision, the refinement schedule of comparisons and the thread pool of the
+         * parallel evaluator.
+         *
+         * @details A context is installed for the current thread with an evaluation_context::scope,
+         * or passed to cend(), real::compare and real::print, which install it for the duration of
+         * the call. Each thread sees its own context, so workloads with different precisions may run
+         * in the same process. The maximum precision of a number is, in order of preference, the one
+         * set on the number itself, the one of the current context, the global one
+         * (const_precision_iterator<T>::global_maximum_precision), or DEFAULT_MAXIMUM_PRECISION.
+         */
+        struct evaluation_context {
+            /// the maximum precision of the numbers that don't set their own
+            std::optional<size_t> maximum_precision;
+
+            /**
+             * LINEAR refines a number one precision step at a time, DOUBLING doubles its precision at
+             * each step, which takes less steps to separate numbers that are very close, at the price
+             * of maybe refining further than needed.
+             */
+            REFINEMENT refinement = REFINEMENT::LINEAR;
+
+            /// the pool of the parallel evaluators built from this context, see parallel_evaluator
+            std::shared_ptr<work_stealing_pool> pool;
+
+        private:
+            inline static thread_local const evaluation_context* _current = nullptr;
+
+        public:
+            /// the context installed for the current thread, or nullptr if there is none
+            static const evaluation_context* current() {
+                return _current;
+            }
+
+            /**
+             * @brief the number of precision steps to refine a number at precision, without going
+             * past maximum + 1, following the refinement schedule of the current context.
+             */
+            static size_t refinement_steps(size_t precision, size_t maximum) {
+                if (_current == nullptr || _current->refinement == REFINEMENT::LINEAR || precision > maximum) {
+                    return 1;
+                }
+                return std::max<size_t>(1, std::min(precision, maximum + 1 - precision));
+            }
+
+            /**
+             * @brief installs a context for the current thread until the end of its scope, restoring
+             * the previous one afterwards. The context must outlive the scope.
+             */
+            class scope {
+            private:
+                const evaluation_context* _previous;
+
+            public:
+                explicit scope(const evaluation_context& context) : _previous(_current) {
+                    _current = &context;
+                }
+
+                /// installs context, or keeps the current one if context is nullptr
+                explicit scope(const evaluation_context* context) : _previous(_current) {
+                    if (context != nullptr) {
+                        _current = context;
+                    }
+                }
+
+                scope(const scope&) = delete;
+                scope& operator=(const scope&) = delete;
+
+                ~scope() {
+                    _current = _previous;
+                }
+            };
+        };
+    }
+}
+
+#endif // BOOST_REAL_EVALUATION_CONTEXT_HPP
@@ -51,7 +51,7 @@ namespace boost {
             }
 
             /// adds other to *this. disregards sign -- that's taken care of in the operators.
-            void add_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
+            void add_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
                 int carry = 0;
                 std::vector<T> temp;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
@@ -107,7 +107,7 @@ namespace boost {
             }
 
             /// subtracts other from *this, disregards sign -- that's taken care of in the operators
-            void subtract_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
+            void subtract_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
                 std::vector<T> result;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
                 int integral_length = std::max(this->exponent, other.exponent);
@@ -575,8 +575,14 @@ namespace boost {
                         temp_dividend.digits.push_back(exact_dividend.digits[j]);
                         temp_dividend.exponent++;
                         if (temp_dividend == zero) {
+                            // the digit brought down gives a zero quotient digit, keep it
                             temp_dividend.clear();
                             temp_dividend.exponent = 0;
+                            quotient.push_back(0);
+                            if (j == m - 1) {
+                                remainder = {0};
+                            }
+                            continue;
                         }
                         while (temp_dividend < exact_divisor) {
                             if (j == m - 1) {
@@ -699,6 +705,9 @@ namespace boost {
                         }
                     }
                 }
+                if (remainder.empty()) {
+                    remainder.push_back(0);
+                }
                 if (normalization_factor >= 1) {
                     T factor = 1 << normalization_factor;
                     std::vector<T> temp = remainder, tempr;
@@ -804,7 +813,7 @@ namespace boost {
                     if (exact_remainder == zero) {
                         if (next_digit < dividend_size) {
                             exact_remainder.digits.clear();
-                            while (dividend[next_digit] == 0 && next_digit < dividend_size) {
+                            while (next_digit < dividend_size && dividend[next_digit] == 0) {
                                 quotient.push_back(0); next_digit++;
                             }
                             if (next_digit == dividend_size) {
@@ -1055,10 +1064,24 @@ namespace boost {
                 exact_number<T> _48(std::vector<T> {48}, 1, true);
                 exact_number<T> _17(std::vector<T> {17}, 1, true);
 
+                /* the guess is within 1/17 of the reciprocal, so a couple of digits of it are enough:
+                 * each step of newton raphson below doubles its correct digits, while each step of
+                 * binary search only adds one bit */
                 reciprocal = _48 - _32*denominator;
-                reciprocal.binary_search_division(_17, max_error_exponent); /* approximate division method */
+                reciprocal.binary_search_division(_17, 2); /* approximate division method */
                 /* Initial guess end*/
 
+                /* newton raphson at growing precision: each step doubles the correct bits of the
+                 * reciprocal, so that it is computed with about as many digits as are correct until
+                 * they reach max_error_exponent, and the steps below are only taken at full precision */
+                const double digit_bits = std::numeric_limits<T>::digits - 2;
+                for (double correct_bits = 4; correct_bits < max_error_exponent * digit_bits; correct_bits = 2 * correct_bits - 2) {
+                    size_t working_digits = (size_t) (2 * correct_bits / digit_bits) + 2;
+                    reciprocal = reciprocal * (two_exact - reciprocal * denominator.up_to(working_digits + 1, false));
+                    reciprocal.normalize();
+                    reciprocal = reciprocal.up_to(working_digits + 1, false);
+                }
+
                 --max_error_exponent; 
                 exact_number<T> error, residual, answer, more_precise_answer;
                 answer = reciprocal * numerator;
@@ -1105,8 +1128,13 @@ namespace boost {
 
                 if (upper) {/* residual shoud be positive or = zero */
 
-                    if (residual < zero) {/* if residual is negative, we make it positive or = zero */
+                    /* if residual is negative, we make it positive or = zero. The newton raphson loop
+                     * stops when the last improvement is below max_error, which does not bound the
+                     * error of the answer, so one step of max_error might not be enough */
+                    while (residual < zero) {
                         (*this) += max_error;
+                        residual = (*this) * denominator - numerator;
+                        residual.normalize();
                     }
 
                     if (residual > zero) {/* if residual is positive, we check if we can make it zero */
@@ -1120,8 +1148,10 @@ namespace boost {
 
                 } else {/* residual shoud be negative = zero */
 
-                    if (residual > zero) {/* if residual is positive, we make it negative or = zero */
+                    while (residual > zero) {/* if residual is positive, we make it negative or = zero */
                         (*this) -= max_error;
+                        residual = (*this) * denominator - numerator;
+                        residual.normalize();
                     }
 
                     if (residual < zero) {/* if residual is negative, we check if we can make it zero */
@@ -1170,12 +1200,12 @@ namespace boost {
                         result = result * number_copy;
                     }
 
-                    number_copy = number_copy * number_copy;
-
                     exponent_vector = quotient;
                     if(((int)exponent_vector.size() == 1 && exponent_vector[0] == 0) || exponent_vector.empty()){
                         break;
                     }
+
+                    number_copy = number_copy * number_copy;
                     quotient.clear();
                     remainder.clear();
                 }
@@ -1401,14 +1431,14 @@ namespace boost {
                 
                 // normalizing decimal_part string
                 size_t idx = decimal_part.size();
-                while(decimal_part[idx-1] == '0')
+                while(idx > 0 && decimal_part[idx-1] == '0')
                     idx--;
                 decimal_part = decimal_part.substr(0, idx);
 
                 // if decimal_part is empty then normalize integer_part
                 if(decimal_part.empty()){
                     idx = integer_part.size();
-                    while(integer_part[idx-1] == '0')
+                    while(idx > 0 && integer_part[idx-1] == '0')
                         idx--;
                     integer_part = integer_part.substr(0, idx);
                 }
@@ -1554,7 +1584,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator+(exact_number<T> other) {
+            exact_number<T> operator+(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive == other.positive) {
@@ -1596,7 +1626,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator-(exact_number<T> other) {
+            exact_number<T> operator-(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive != other.positive) {
@@ -1645,7 +1675,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator*(exact_number<T> other) {
+            exact_number<T> operator*(exact_number<T> other) const {
                 exact_number<T> result = *this;
                 result.multiply_vector(other);
                 result.positive = (this->positive == other.positive);
@@ -1937,12 +1967,12 @@ namespace boost {
              *
              * @return an unsigned long representing the number of digits of the boost::real::exact_number
              */
-            unsigned long size() {
+            unsigned long size() const {
                 return this->digits.size();
             }
 
             /// returns an exact_number that has the precision given
-            exact_number<T> up_to(size_t precision, bool upper) {
+            exact_number<T> up_to(size_t precision, bool upper) const {
                 T base = (std::numeric_limits<T>::max() /4)*2 - 1;
                 if (precision >= digits.size())
                     return *this;
@@ -1962,7 +1992,7 @@ namespace boost {
                 return ret;
             }
 
-            bool is_integral() { 
+            bool is_integral() const {
                    return digits.size() <= (size_t) exponent;
             }
 
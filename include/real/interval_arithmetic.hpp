@@ -0,0 +1,526 @@
+#ifndef BOOST_REAL_INTERVAL_ARITHMETIC_HPP
+#define BOOST_REAL_INTERVAL_ARITHMETIC_HPP
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <real/interval.hpp>
+#include <real/exact_number.hpp>
+#include <real/real_exception.hpp>
+#include <real/real_math.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * The functions in this file compute the approximation interval of an operation from the
+         * approximation intervals of its operands, at a given precision. They do not iterate the
+         * operands: the ones that need tighter operands (division by an interval that contains zero,
+         * logarithm of an interval that is not strictly positive) throw, and the caller decides
+         * whether to iterate the operands further or give up.
+         *
+         * They are shared by const_precision_iterator::update_operation_boundaries and by the
+         * flattened evaluation of boost::real::compiled_real.
+         */
+
+        /// [a, b] + [c, d] = [a + c, b + d]
+        template <typename T>
+        interval<T> interval_add(const interval<T>& lhs, const interval<T>& rhs, size_t precision) {
+            interval<T> result;
+            result.lower_bound = lhs.lower_bound.up_to(precision, false) + rhs.lower_bound.up_to(precision, false);
+            result.upper_bound = lhs.upper_bound.up_to(precision, true) + rhs.upper_bound.up_to(precision, true);
+            return result;
+        }
+
+        /// [a, b] - [c, d] = [a - d, b - c]
+        template <typename T>
+        interval<T> interval_subtract(const interval<T>& lhs, const interval<T>& rhs, size_t precision) {
+            interval<T> result;
+            result.lower_bound = lhs.lower_bound.up_to(precision, false) - rhs.upper_bound.up_to(precision, true);
+            result.upper_bound = lhs.upper_bound.up_to(precision, true) - rhs.lower_bound.up_to(precision, false);
+            return result;
+        }
+
+        /// [a, b] * [c, d], choosing the products of the bounds from the operands signs
+        template <typename T>
+        interval<T> interval_multiply(const interval<T>& lhs, const interval<T>& rhs, size_t precision) {
+            interval<T> result;
+            exact_number<T> lhs_lower = lhs.lower_bound.up_to(precision, false);
+            exact_number<T> lhs_upper = lhs.upper_bound.up_to(precision, true);
+            exact_number<T> rhs_lower = rhs.lower_bound.up_to(precision, false);
+            exact_number<T> rhs_upper = rhs.upper_bound.up_to(precision, true);
+
+            if (lhs.positive() && rhs.positive()) { // Positive - Positive
+                result.lower_bound = lhs_lower * rhs_lower;
+                result.upper_bound = lhs_upper * rhs_upper;
+            } else if (lhs.negative() && rhs.negative()) { // Negative - Negative
+                result.lower_bound = lhs_upper * rhs_upper;
+                result.upper_bound = lhs_lower * rhs_lower;
+            } else if (lhs.negative() && rhs.positive()) { // Negative - Positive
+                result.lower_bound = lhs_lower * rhs_upper;
+                result.upper_bound = lhs_upper * rhs_lower;
+            } else if (lhs.positive() && rhs.negative()) { // Positive - Negative
+                result.lower_bound = lhs_upper * rhs_lower;
+                result.upper_bound = lhs_lower * rhs_upper;
+            } else { // One is around zero all possible combinations are be tested
+                exact_number<T> products[] = {lhs_lower * rhs_lower, lhs_upper * rhs_upper,
+                                              lhs_lower * rhs_upper, lhs_upper * rhs_lower};
+                result.lower_bound = *std::min_element(std::begin(products), std::end(products));
+                result.upper_bound = *std::max_element(std::begin(products), std::end(products));
+            }
+            return result;
+        }
+
+        /**
+         * @brief [a, b] / [c, d], the bounds are rounded outwards at the given precision.
+         * @throws boost::real::divergent_division_result_exception if [c, d] contains zero.
+         */
+        template <typename T>
+        interval<T> interval_divide(const interval<T>& lhs, const interval<T>& rhs, size_t precision) {
+            interval<T> result;
+            exact_number<T> numerator;
+            exact_number<T> denominator;
+            bool deviation_upper_boundary = true, deviation_lower_boundary = false;
+
+            /* if the interval contains zero, one side of the result interval tends towards +/-infinity */
+            if (!rhs.positive() && !rhs.negative())
+                throw boost::real::divergent_division_result_exception();
+
+            /* Upper Boundary */
+            if (lhs.positive()) {
+                if (rhs.positive()) {
+                    deviation_upper_boundary = true;
+                    numerator = lhs.upper_bound;
+                    denominator = rhs.lower_bound;
+                } else {
+                    deviation_upper_boundary = false;
+                    numerator = lhs.lower_bound;
+                    denominator = rhs.lower_bound;
+                }
+            } else if (lhs.negative()) {
+                if (rhs.positive()) {
+                    deviation_upper_boundary = false;
+                    numerator = lhs.upper_bound;
+                    denominator = rhs.upper_bound;
+                } else {
+                    deviation_upper_boundary = true;
+                    numerator = lhs.lower_bound;
+                    denominator = rhs.upper_bound;
+                }
+            } else {
+                if (rhs.positive()) {
+                    deviation_upper_boundary = true;
+                    numerator = lhs.upper_bound;
+                    denominator = rhs.lower_bound;
+                } else {
+                    deviation_upper_boundary = true;
+                    numerator = lhs.lower_bound;
+                    denominator = rhs.upper_bound;
+                }
+            }
+
+            result.upper_bound = numerator;
+            result.upper_bound.divide_vector(denominator, precision, deviation_upper_boundary);
+
+            /* Lower Boundary */
+            if (lhs.positive()) {
+                if (rhs.positive()) {
+                    deviation_lower_boundary = false;
+                    numerator = lhs.lower_bound;
+                    denominator = rhs.upper_bound;
+                } else {
+                    deviation_lower_boundary = true;
+                    numerator = lhs.upper_bound;
+                    denominator = rhs.upper_bound;
+                }
+            } else if (lhs.negative()) {
+                if (rhs.positive()) {
+                    deviation_lower_boundary = true;
+                    numerator = lhs.lower_bound;
+                    denominator = rhs.lower_bound;
+                } else {
+                    deviation_lower_boundary = false;
+                    numerator = lhs.upper_bound;
+                    denominator = rhs.lower_bound;
+                }
+            } else {
+                if (rhs.positive()) {
+                    deviation_lower_boundary = true;
+                    numerator = lhs.lower_bound;
+                    denominator = rhs.lower_bound;
+                } else {
+                    deviation_lower_boundary = true;
+                    numerator = lhs.upper_bound;
+                    denominator = rhs.upper_bound;
+                }
+            }
+
+            result.lower_bound = numerator;
+            result.lower_bound.divide_vector(denominator, precision, deviation_lower_boundary);
+            return result;
+        }
+
+        /**
+         * @brief [a, b] ^ n, for a non negative integer n.
+         * @throws boost::real::non_integral_exponent_exception if exponent is not an integer.
+         * @throws boost::real::negative_integers_not_supported if exponent is negative.
+         */
+        template <typename T>
+        interval<T> interval_power(const interval<T>& base, const exact_number<T>& exponent) {
+            if ((int) exponent.digits.size() > exponent.exponent) {
+                throw non_integral_exponent_exception();
+            }
+
+            if (exponent.positive == false) {
+                throw negative_integers_not_supported();
+            }
+
+            interval<T> result;
+            exact_number<T> zero = exact_number<T> (), tmp;
+
+            std::vector<T> exponent_vector, quotient, remainder;
+            exponent_vector = exponent.digits;
+            while ((int) exponent_vector.size() < exponent.exponent) {
+                exponent_vector.push_back(0);
+            }
+
+            tmp.division_by_single_digit(exponent_vector, std::vector<T> {2}, quotient, remainder);
+
+            bool exponent_is_even = false;
+
+            if (remainder.empty() || remainder == std::vector<T> {0}) {
+                exponent_is_even = true;
+            }
+
+            if (base.positive()) {
+                result.upper_bound = tmp.binary_exponentiation(base.upper_bound, exponent);
+                result.lower_bound = tmp.binary_exponentiation(base.lower_bound, exponent);
+            } else if (base.negative()) {
+                if (exponent_is_even) {
+                    result.upper_bound = tmp.binary_exponentiation(base.lower_bound, exponent);
+                    result.lower_bound = tmp.binary_exponentiation(base.upper_bound, exponent);
+                } else {
+                    result.upper_bound = tmp.binary_exponentiation(base.upper_bound, exponent);
+                    result.lower_bound = tmp.binary_exponentiation(base.lower_bound, exponent);
+                }
+            } else {
+                if (exponent_is_even) {
+                    if (base.upper_bound.abs() > base.lower_bound.abs()) {
+                        result.upper_bound = tmp.binary_exponentiation(base.upper_bound, exponent);
+                    } else {
+                        result.upper_bound = tmp.binary_exponentiation(base.lower_bound, exponent);
+                    }
+                    result.lower_bound = zero;
+                } else {
+                    result.upper_bound = tmp.binary_exponentiation(base.upper_bound, exponent);
+                    result.lower_bound = tmp.binary_exponentiation(base.lower_bound, exponent);
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief whether [a, b] is narrow enough for interval_mean_value: narrower than
+         * base^(-precision / 2), so that the terms in (b - a)^2 the enclosure leaves out of its
+         * derivative bound are under base^(-precision).
+         */
+        template <typename T>
+        bool narrow_for_mean_value(const exact_number<T>& lower, const exact_number<T>& upper, size_t precision) {
+            return lower != upper && upper - lower < exact_number<T>(std::vector<T> {1}, 1 - (int) ((precision + 1) / 2));
+        }
+
+        /**
+         * @brief f[a, b] by the mean value theorem: f(m) ± sup|f'| * r, with m the middle of [a, b]
+         * and r its radius. f is evaluated once, at m, where the bounds of f at a and b take two
+         * evaluations, and the result is as tight as theirs when [a, b] is narrow, see
+         * narrow_for_mean_value.
+         *
+         * @param f - f(x, precision, upper), within base^(-precision) as the functions of real_math.
+         * @param derivative_bound - an upper bound of |f'| over [a, b], from f(m) rounded down, m
+         * and r. It is only needed to a couple of digits.
+         */
+        template <typename T, typename F, typename D>
+        interval<T> interval_mean_value(const exact_number<T>& lower, const exact_number<T>& upper, size_t precision,
+                                        const F& f, const D& derivative_bound) {
+            static const exact_number<T> half(std::vector<T> {std::numeric_limits<T>::max() / 4}, 0, true);
+            exact_number<T> radius = (upper - lower) * half;
+            exact_number<T> middle = lower + radius;
+
+            exact_number<T> value = f(middle, precision, false);
+            exact_number<T> spread = derivative_bound(value, middle, radius).up_to(2, true) * radius.up_to(2, true);
+
+            interval<T> result;
+            result.lower_bound = value - spread;
+            result.upper_bound = value + exact_number<T>(std::vector<T> {1}, 1 - (int) precision) + spread;
+            return result;
+        }
+
+        /// e^[a, b] = [e^a, e^b], or e^m ± e^(m + r) * r when [a, b] is narrow, see interval_mean_value
+        template <typename T>
+        interval<T> interval_exponent(const interval<T>& x, size_t precision) {
+            exact_number<T> lower = x.lower_bound.up_to(precision, false);
+            exact_number<T> upper = x.upper_bound.up_to(precision, true);
+            if (narrow_for_mean_value(lower, upper, precision)) {
+                // e^x <= e^m * e^r <= e^m * (1 + 2r), as r < 1
+                exact_number<T> error(std::vector<T> {1}, 1 - (int) precision);
+                return interval_mean_value(lower, upper, precision,
+                    [](const exact_number<T>& y, size_t p, bool round_up) { return exponent(y, p, round_up); },
+                    [&error](const exact_number<T>& value, const exact_number<T>&, const exact_number<T>& radius) {
+                        return (value + error).up_to(2, true) * (literals::one_exact<T> + literals::two_exact<T> * radius.up_to(2, true));
+                    });
+            }
+
+            interval<T> result;
+            result.lower_bound = exponent(lower, precision, false);
+            result.upper_bound = exponent(upper, precision, true);
+            return result;
+        }
+
+        /**
+         * @brief ln[a, b] = [ln a, ln b], or ln m ± r/a when [a, b] is narrow, see interval_mean_value
+         * @throws boost::real::logarithm_not_defined_for_non_positive_number if a <= 0.
+         */
+        template <typename T>
+        interval<T> interval_logarithm(const interval<T>& x, size_t precision) {
+            if (x.lower_bound.up_to(precision, true) == literals::zero_exact<T> || x.lower_bound.up_to(precision, true).positive == false) {
+                throw logarithm_not_defined_for_non_positive_number();
+            }
+
+            exact_number<T> lower = x.lower_bound.up_to(precision, false);
+            exact_number<T> upper = x.upper_bound.up_to(precision, true);
+            if (narrow_for_mean_value(lower, upper, precision) && lower.positive && lower != literals::zero_exact<T>) {
+                // 1/x <= 1/a, with 1/a rounded up to a couple of digits
+                return interval_mean_value(lower, upper, precision,
+                    [](const exact_number<T>& y, size_t p, bool round_up) { return logarithm(y, p, round_up); },
+                    [&lower](const exact_number<T>&, const exact_number<T>&, const exact_number<T>&) {
+                        exact_number<T> reciprocal = literals::one_exact<T>;
+                        reciprocal.divide_vector(lower.up_to(2, false), (size_t) std::max(lower.exponent, 0) + 2, true);
+                        return reciprocal;
+                    });
+            }
+
+            interval<T> result;
+            result.lower_bound = logarithm(lower, precision, false);
+            result.upper_bound = logarithm(upper, precision, true);
+            return result;
+        }
+
+        /**
+         * @brief [a, b]^(1/n) = [a^(1/n), b^(1/n)], with the part of [a, b] below zero left out if n
+         * is even, since its root is not real.
+         * @throws boost::real::non_integral_exponent_exception if n is not an integer.
+         * @throws boost::real::root_degree_out_of_range if n <= 0, or n is not a single digit.
+         * @throws boost::real::even_root_of_negative_number if n is even and b < 0.
+         */
+        template <typename T>
+        interval<T> interval_root(const interval<T>& x, const exact_number<T>& degree, size_t precision) {
+            if (degree == literals::zero_exact<T> || !degree.positive) {
+                throw root_degree_out_of_range();
+            }
+            if ((int) degree.digits.size() > degree.exponent) {
+                throw non_integral_exponent_exception();
+            }
+            if (degree.exponent > 1) {
+                throw root_degree_out_of_range();
+            }
+            unsigned long n = (unsigned long) degree.digits[0];
+
+            interval<T> result;
+            if (n % 2 == 0 && x.upper_bound < literals::zero_exact<T>) {
+                throw even_root_of_negative_number();
+            }
+            if (n % 2 == 0 && x.lower_bound < literals::zero_exact<T>) {
+                result.lower_bound = literals::zero_exact<T>;
+            } else {
+                result.lower_bound = nth_root(x.lower_bound.up_to(precision, false), n, precision, false);
+            }
+            result.upper_bound = nth_root(x.upper_bound.up_to(precision, true), n, precision, true);
+            return result;
+        }
+
+        /**
+         * @brief sqrt[a, b] = [sqrt a, sqrt b], see interval_root
+         * @throws boost::real::sqrt_not_defined_for_negative_number if b < 0.
+         */
+        template <typename T>
+        interval<T> interval_square_root(const interval<T>& x, size_t precision) {
+            if (x.upper_bound < literals::zero_exact<T>) {
+                throw sqrt_not_defined_for_negative_number();
+            }
+            return interval_root(x, literals::two_exact<T>, precision);
+        }
+
+        /**
+         * sin(x + shift * π/2) over [a, b], shift being 0 for sine and 1 for cosine.
+         *
+         * The bounds are reduced modulo π/2, see reduce_half_pi, which places them between extrema:
+         * a = k * π/2 + r, with |r| <= π/4 about, lies after the extremum at k * π/2 if k is odd
+         * (after the shift) and r is positive, and before the one at (k + 1) * π/2 otherwise. The
+         * extrema inside [a, b] are counted from the first one after a to the last one before b.
+         * With none, the function is monotone on [a, b], with one, it reaches 1 or -1, and with more,
+         * both. When a bound is too close to an extremum for the sign of r to be known, the extremum
+         * is counted, which only widens the result.
+         *
+         * A narrow [a, b] is not reduced at both bounds but enclosed around its middle, see
+         * interval_mean_value.
+         */
+        template <typename T>
+        interval<T> interval_shifted_sine(const interval<T>& x, int shift, size_t precision) {
+            exact_number<T> lower_bound = x.lower_bound.up_to(precision, false);
+            exact_number<T> upper_bound = x.upper_bound.up_to(precision, true);
+            if (narrow_for_mean_value(lower_bound, upper_bound, precision)) {
+                // the derivative is sin(x + (shift + 1) * π/2), bounded by its value at the first
+                // digits h of m, plus |m - h| and r
+                return interval_mean_value(lower_bound, upper_bound, precision,
+                    [shift](const exact_number<T>& y, size_t p, bool round_up) {
+                        return reduced_sine(reduce_half_pi(y, p), shift, p, round_up);
+                    },
+                    [shift](const exact_number<T>&, const exact_number<T>& middle, const exact_number<T>& radius) {
+                        exact_number<T> head = middle.up_to(2, false);
+                        exact_number<T> derivative = reduced_sine(reduce_half_pi(head, 2), shift + 1, 2, true);
+                        return derivative.abs() + exact_number<T>(std::vector<T> {1}, -1) + (middle - head) + radius;
+                    });
+            }
+
+            half_pi_reduction<T> lower = reduce_half_pi(lower_bound, precision);
+            half_pi_reduction<T> upper = reduce_half_pi(upper_bound, precision);
+
+            // the extrema are at the odd multiples of π/2, after the shift, so the first one at or
+            // after a is 0, 1 or 2 quarters of a turn after its quotient, and the last one at or
+            // before b is 0, 1 or 2 quarters before its quotient
+            int lower_quadrant = (lower.quadrant + shift) % 4;
+            int upper_quadrant = (upper.quadrant + shift) % 4;
+            int after_lower = (lower_quadrant % 2 == 0) ? 1 : (lower.lower.positive && lower.lower != literals::zero_exact<T>) ? 2 : 0;
+            int before_upper = (upper_quadrant % 2 == 0) ? 1 : (!upper.upper.positive && upper.upper != literals::zero_exact<T>) ? 2 : 0;
+
+            // the quarters of a turn from the first extremum to the last one
+            exact_number<T> extrema_span = upper.quotient - lower.quotient - integer_exact<T>(after_lower + before_upper);
+
+            interval<T> result;
+            if (extrema_span >= literals::two_exact<T>) {
+                result.lower_bound = literals::minus_one_exact<T>;
+                result.upper_bound = literals::one_exact<T>;
+                return result;
+            }
+
+            exact_number<T> lower_of_lower = reduced_sine(lower, shift, precision, false);
+            exact_number<T> upper_of_lower = reduced_sine(lower, shift, precision, true);
+            exact_number<T> lower_of_upper = reduced_sine(upper, shift, precision, false);
+            exact_number<T> upper_of_upper = reduced_sine(upper, shift, precision, true);
+            result.lower_bound = std::min(lower_of_lower, lower_of_upper);
+            result.upper_bound = std::max(upper_of_lower, upper_of_upper);
+
+            if (extrema_span == literals::zero_exact<T>) {
+                // a maximum in the quadrant 1, a minimum in the quadrant 3
+                if ((lower_quadrant + after_lower) % 4 == 1) {
+                    result.upper_bound = literals::one_exact<T>;
+                } else {
+                    result.lower_bound = literals::minus_one_exact<T>;
+                }
+            }
+            return result;
+        }
+
+        /// sin[a, b], taking the extrema of sine inside [a, b] into account
+        template <typename T>
+        interval<T> interval_sine(const interval<T>& x, size_t precision) {
+            return interval_shifted_sine(x, 0, precision);
+        }
+
+        /// cos[a, b], taking the extrema of cosine inside [a, b] into account
+        template <typename T>
+        interval<T> interval_cosine(const interval<T>& x, size_t precision) {
+            return interval_shifted_sine(x, 1, precision);
+        }
+
+        /// atan[a, b] = [atan a, atan b]
+        template <typename T>
+        interval<T> interval_arctangent(const interval<T>& x, size_t precision) {
+            interval<T> result;
+            result.lower_bound = arctangent(x.lower_bound.up_to(precision, false), precision, false);
+            result.upper_bound = arctangent(x.upper_bound.up_to(precision, true), precision, true);
+            return result;
+        }
+
+        /**
+         * @brief [a, b] cut to [-1, 1], the domain of arcsine and arccosine. Like the even roots of
+         * interval_root, the part of [a, b] out of the domain is left out.
+         * @throws boost::real::arcsine_not_defined_outside_unit_interval if [a, b] has no point in [-1, 1].
+         */
+        template <typename T>
+        interval<T> unit_interval_part(const interval<T>& x, size_t precision) {
+            if (x.lower_bound > literals::one_exact<T> || x.upper_bound < literals::minus_one_exact<T>) {
+                throw arcsine_not_defined_outside_unit_interval();
+            }
+            interval<T> result;
+            result.lower_bound = std::max(x.lower_bound.up_to(precision, false), literals::minus_one_exact<T>);
+            result.upper_bound = std::min(x.upper_bound.up_to(precision, true), literals::one_exact<T>);
+            return result;
+        }
+
+        /**
+         * @brief asin[a, b] = [asin a, asin b], see unit_interval_part
+         * @throws boost::real::arcsine_not_defined_outside_unit_interval if [a, b] has no point in [-1, 1].
+         */
+        template <typename T>
+        interval<T> interval_arcsine(const interval<T>& x, size_t precision) {
+            interval<T> domain = unit_interval_part(x, precision);
+            interval<T> result;
+            result.lower_bound = arcsine(domain.lower_bound, precision, false);
+            result.upper_bound = arcsine(domain.upper_bound, precision, true);
+            return result;
+        }
+
+        /**
+         * @brief acos[a, b] = [acos b, acos a], see unit_interval_part
+         * @throws boost::real::arcsine_not_defined_outside_unit_interval if [a, b] has no point in [-1, 1].
+         */
+        template <typename T>
+        interval<T> interval_arccosine(const interval<T>& x, size_t precision) {
+            interval<T> domain = unit_interval_part(x, precision);
+            interval<T> result;
+            result.lower_bound = arccosine(domain.upper_bound, precision, false);
+            result.upper_bound = arccosine(domain.lower_bound, precision, true);
+            return result;
+        }
+
+        /// sinh[a, b] = [sinh a, sinh b]
+        template <typename T>
+        interval<T> interval_hyperbolic_sine(const interval<T>& x, size_t precision) {
+            interval<T> result;
+            result.lower_bound = std::get<0>(sinh_cosh(x.lower_bound.up_to(precision, false), precision, false));
+            result.upper_bound = std::get<0>(sinh_cosh(x.upper_bound.up_to(precision, true), precision, true));
+            return result;
+        }
+
+        /// cosh[a, b], which decreases up to 0 and increases after it, so that it is 1 at least if 0 is in [a, b]
+        template <typename T>
+        interval<T> interval_hyperbolic_cosine(const interval<T>& x, size_t precision) {
+            exact_number<T> lower = x.lower_bound.up_to(precision, false);
+            exact_number<T> upper = x.upper_bound.up_to(precision, true);
+            exact_number<T> farthest = std::max(lower.abs(), upper.abs());
+
+            interval<T> result;
+            if (lower <= literals::zero_exact<T> && literals::zero_exact<T> <= upper) {
+                result.lower_bound = literals::one_exact<T>;
+            } else {
+                result.lower_bound = std::get<1>(sinh_cosh(std::min(lower.abs(), upper.abs()), precision, false));
+            }
+            result.upper_bound = std::get<1>(sinh_cosh(farthest, precision, true));
+            return result;
+        }
+
+        /// tanh[a, b] = [tanh a, tanh b]
+        template <typename T>
+        interval<T> interval_hyperbolic_tangent(const interval<T>& x, size_t precision) {
+            interval<T> result;
+            result.lower_bound = hyperbolic_tangent(x.lower_bound.up_to(precision, false), precision, false);
+            result.upper_bound = hyperbolic_tangent(x.upper_bound.up_to(precision, true), precision, true);
+            return result;
+        }
+    }
+}
+
+#endif // BOOST_REAL_INTERVAL_ARITHMETIC_HPP
@@ -0,0 +1,184 @@
+#ifndef BOOST_REAL_PARALLEL_EVALUATOR_HPP
+#define BOOST_REAL_PARALLEL_EVALUATOR_HPP
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#include <real/real.hpp>
+#include <real/work_stealing_pool.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief boost::real::parallel_evaluator iterates the operation tree of a boost::real::real
+         * up to a given precision, evaluating the two operands of an operation in parallel on a
+         * boost::real::work_stealing_pool.
+         *
+         * @details Before an operation node is iterated its operands are brought to the target
+         * precision, the right one as a forked task and the left one by the current thread, so the
+         * node itself only combines the operands' intervals. Forking is only worth it for large
+         * subtrees: the cost of a subtree is estimated by its number of nodes, and the operands are
+         * evaluated in parallel only if both cost at least fork_threshold.
+         *
+         * The nodes of a tree are iterated in place, with the node locked, so other threads may
+         * evaluate the same numbers meanwhile. Two tasks reaching the same node would only wait for
+         * each other, so a node with more than one parent in the tree (a shared subexpression, or an
+         * operation with the same number on both sides) makes every subtree holding it be evaluated
+         * sequentially.
+         *
+         * The result is the same as sequentially iterating the number to that precision, and the
+         * reached precision is kept in the nodes, as after comparing or printing the number. The
+         * forked tasks run with the evaluation_context of the thread that called evaluate.
+         */
+        template <typename T = int>
+        class parallel_evaluator {
+        private:
+            struct node_info {
+                size_t parents = 0;
+                size_t cost = 0;     // number of distinct nodes of the subtree
+                bool shared = false; // the subtree holds a node with more than one parent
+            };
+
+            std::shared_ptr<work_stealing_pool> _pool;
+            size_t _fork_threshold;
+
+            using info_map = std::unordered_map<const real_data<T>*, node_info>;
+
+            static const real_operation<T>* operation_of(const std::shared_ptr<real_data<T>>& node) {
+                return std::get_if<real_operation<T>>(node->get_real_ptr());
+            }
+
+            // counts the parents of every node of the tree
+            static void count_parents(const std::shared_ptr<real_data<T>>& node, info_map& info) {
+                if (info[node.get()].parents++ > 0) {
+                    return;
+                }
+                if (auto op = operation_of(node)) {
+                    count_parents(op->lhs(), info);
+                    count_parents(op->rhs(), info);
+                }
+            }
+
+            // computes the cost and shared flag of the subtree of node, once per node
+            static const node_info& estimate(const std::shared_ptr<real_data<T>>& node, info_map& info) {
+                node_info& ni = info[node.get()];
+                if (ni.cost > 0) {
+                    return ni;
+                }
+
+                ni.cost = 1;
+                ni.shared = ni.parents > 1;
+                if (auto op = operation_of(node)) {
+                    const node_info& lhs = estimate(op->lhs(), info);
+                    ni.cost += lhs.cost;
+                    ni.shared = ni.shared || lhs.shared;
+                    if (op->rhs() != op->lhs()) {
+                        const node_info& rhs = estimate(op->rhs(), info);
+                        ni.cost += rhs.cost;
+                        ni.shared = ni.shared || rhs.shared;
+                    } else {
+                        ni.shared = true;
+                    }
+                }
+                return ni;
+            }
+
+            void evaluate(const std::shared_ptr<real_data<T>>& node, size_t precision, const info_map& info) {
+                bool reached = node->with_precision_itr([precision](const_precision_iterator<T>& it) {
+                    return it.get_precision() >= precision;
+                });
+                if (reached) {
+                    return;
+                }
+
+                if (auto op = operation_of(node)) {
+                    auto lhs = op->lhs();
+                    auto rhs = op->rhs();
+                    const node_info& lhs_info = info.at(lhs.get());
+                    const node_info& rhs_info = info.at(rhs.get());
+
+                    if (!lhs_info.shared && !rhs_info.shared &&
+                        std::min(lhs_info.cost, rhs_info.cost) >= _fork_threshold) {
+                        auto task = _pool->fork([this, &rhs, precision, &info,
+                                                 context = evaluation_context::current()] {
+                            evaluation_context::scope scope(context);
+                            evaluate(rhs, precision, info);
+                        });
+                        try {
+                            evaluate(lhs, precision, info);
+                        } catch (...) {
+                            // the task refers to this frame, it has to end before leaving it
+                            try {
+                                _pool->join(task);
+                            } catch (...) {}
+                            throw;
+                        }
+                        _pool->join(task);
+                    } else {
+                        evaluate(lhs, precision, info);
+                        evaluate(rhs, precision, info);
+                    }
+                }
+
+                // the operands are already at precision, so only the node's interval is computed here
+                node->with_precision_itr([precision](const_precision_iterator<T>& it) {
+                    if (it.get_precision() < precision) {
+                        it.iterate_n_times(precision - it.get_precision());
+                    }
+                });
+            }
+
+        public:
+            /**
+             * @brief an evaluator on a new pool of threads workers.
+             *
+             * @param threads - the number of worker threads.
+             * @param fork_threshold - the minimum number of nodes of both operands of an operation
+             * for them to be evaluated in parallel.
+             */
+            explicit parallel_evaluator(size_t threads = std::thread::hardware_concurrency(), size_t fork_threshold = 32)
+                : _pool(std::make_shared<work_stealing_pool>(threads)), _fork_threshold(fork_threshold) {};
+
+            /// an evaluator on an existing pool, that may be shared with other evaluators
+            parallel_evaluator(std::shared_ptr<work_stealing_pool> pool, size_t fork_threshold = 32)
+                : _pool(std::move(pool)), _fork_threshold(fork_threshold) {};
+
+            /// an evaluator on the pool of context, or on a new pool if context has none
+            explicit parallel_evaluator(const evaluation_context& context, size_t fork_threshold = 32)
+                : _pool(context.pool ? context.pool : std::make_shared<work_stealing_pool>()),
+                  _fork_threshold(fork_threshold) {};
+
+            size_t fork_threshold() const {
+                return _fork_threshold;
+            }
+
+            /**
+             * @brief iterates number up to precision, or up to its maximum precision if lower.
+             *
+             * @param number - the boost::real::real number to evaluate.
+             * @param precision - the precision to reach.
+             * @return the approximation interval of number at that precision.
+             */
+            interval<T> evaluate(const real<T>& number, size_t precision) {
+                precision = std::min<size_t>(precision, number.maximum_precision());
+
+                info_map info;
+                count_parents(number._real_p, info);
+                estimate(number._real_p, info);
+
+                evaluate(number._real_p, precision, info);
+                return number.get_real_itr().get_interval();
+            }
+
+            /// iterates number up to its maximum precision, as cend()
+            interval<T> evaluate(const real<T>& number) {
+                return evaluate(number, number.maximum_precision());
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_PARALLEL_EVALUATOR_HPP
@@ -10,6 +10,9 @@
 #include <utility>
 #include <memory> // shared_ptr
 #include <variant>
+#include <functional>
+#include <future>
+#include <thread>
 
 #include <real/real_exception.hpp>
 #include <real/real_explicit.hpp>
@@ -17,6 +20,9 @@
 #include <real/real_operation.hpp>
 #include <real/const_precision_iterator.hpp>
 #include <real/real_data.hpp>
+#include <real/real_node_pool.hpp>
+#include <real/real_node_table.hpp>
+#include <real/evaluation_budget.hpp>
 
 
 namespace boost {
@@ -30,6 +36,61 @@ namespace boost {
          **/
         enum class TYPE{EXPLICIT, INTEGER, RATIONAL, ALGORITHM, OPERATION};
 
+        /// result of the three-way comparison of two numbers, see real::compare
+        enum class ORDERING{LESS, EQUAL, GREATER};
+
+        /**
+         * @brief the result of a comparison within an evaluation_budget: the ordering, if status is
+         * BUDGET_STATUS::DECIDED, and the last approximation intervals of both numbers.
+         */
+        template <typename T>
+        struct budgeted_comparison {
+            BUDGET_STATUS status;
+            ORDERING ordering; // ORDERING::EQUAL if the status is BUDGET_STATUS::UNDECIDED
+            interval<T> this_approximation;
+            interval<T> other_approximation;
+        };
+
+        /**
+         * @brief the result of an evaluation within an evaluation_budget: the most precise
+         * approximation interval reached, and its precision. The status is BUDGET_STATUS::DECIDED
+         * if the requested precision was reached.
+         */
+        template <typename T>
+        struct budgeted_evaluation {
+            BUDGET_STATUS status;
+            interval<T> approximation;
+            size_t precision;
+        };
+
+        /**
+         * @brief runs a task, see real::evaluate_async and real::compare_async. The task may run on
+         * any thread, now or later.
+         */
+        using executor = std::function<void(std::function<void()>)>;
+
+        /// an executor that submits the tasks to pool
+        inline executor pool_executor(std::shared_ptr<work_stealing_pool> pool) {
+            return [pool](std::function<void()> task) {
+                pool->submit(std::move(task));
+            };
+        }
+
+        // fwd decl needed
+        template <typename T>
+        class compiled_real;
+
+        template <typename T>
+        class real_terminal;
+
+        template <typename T>
+        class parallel_evaluator;
+
+        namespace detail {
+            template <typename T>
+            class adaptive_order;
+        }
+
         /**
          * @author Laouen Mayal Louan Belloli
          *
@@ -73,6 +134,218 @@ namespace boost {
             // ctor from shared_ptr to (already init) real_data. used in check_and_distribute.
             real(std::shared_ptr<real_data<T>> x) : _real_p(x){};
 
+            friend class compiled_real<T>;
+            friend class real_terminal<T>;
+            friend class detail::adaptive_order<T>;
+            friend class parallel_evaluator<T>;
+
+            // builds the balanced tree of op over the operands [first, last)
+            static std::shared_ptr<real_data<T>> balanced_tree(std::vector<std::shared_ptr<real_data<T>>>& operands,
+                                                                size_t first, size_t last, OPERATION op) {
+                if (last - first == 1) {
+                    return operands[first];
+                }
+                size_t middle = first + (last - first) / 2;
+                auto lhs = balanced_tree(operands, first, middle, op);
+                auto rhs = balanced_tree(operands, middle, last, op);
+                return real_node_table<T>::make_operation(real_operation<T>(lhs, rhs, op));
+            }
+
+            // the budget of a comparison in progress, if any, and the work done so far
+            struct budget_progress {
+                const evaluation_budget* budget;
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                size_t refinements = 0;
+
+                bool exhausted(const interval<T>& approximation) const {
+                    size_t limbs = std::max(approximation.lower_bound.digits.size(), approximation.upper_bound.digits.size());
+                    return budget != nullptr && budget->exhausted(start, refinements, limbs);
+                }
+            };
+
+            // the approximation interval currently kept in the node
+            interval<T> current_interval() const {
+                return _real_p->with_precision_itr([](const_precision_iterator<T>& it) { return it.get_interval(); });
+            }
+
+            /*
+             * Compares *this against the rational number other, refining *this at most maximum_steps
+             * times, or until the budget of progress runs out.
+             */
+            budgeted_comparison<T> compare_with_rational(const real<T>& other, size_t maximum_steps, budget_progress& progress) const {
+                const real_rational<T>& r = std::get<real_rational<T>>(other._real_p->get_real_number());
+                exact_number<T> numerator = real_explicit<T>(r.a).get_exact_number();
+                exact_number<T> denominator = real_explicit<T>(r.b).get_exact_number();
+                numerator.positive = r.positive || r.a == real_rational<T>::zero;
+
+                auto it = this->refined_itr();
+                while (true) {
+                    // the denominator is positive, so x < a/b if and only if x * b < a
+                    const interval<T> approximation = it.get_interval();
+                    if (approximation.upper_bound * denominator < numerator) {
+                        return {BUDGET_STATUS::DECIDED, ORDERING::LESS, approximation, other.current_interval()};
+                    }
+                    if (approximation.lower_bound * denominator > numerator) {
+                        return {BUDGET_STATUS::DECIDED, ORDERING::GREATER, approximation, other.current_interval()};
+                    }
+                    if (approximation.is_a_number()) {
+                        return {BUDGET_STATUS::DECIDED, ORDERING::EQUAL, approximation, other.current_interval()};
+                    }
+                    if (it.get_precision() > maximum_steps || progress.exhausted(approximation)) {
+                        return {BUDGET_STATUS::UNDECIDED, ORDERING::EQUAL, approximation, other.current_interval()};
+                    }
+                    it = this->refine(maximum_steps);
+                    progress.refinements++;
+                }
+            }
+
+            /*
+             * The three-way comparison of compare(other), which stops refining when the budget of
+             * progress runs out or the maximum precision is reached, with an undecided result.
+             */
+            budgeted_comparison<T> compare_within(const real<T>& other, budget_progress& progress) const {
+                if (this->_real_p == other._real_p) {
+                    interval<T> approximation = this->current_interval();
+                    return {BUDGET_STATUS::DECIDED, ORDERING::EQUAL, approximation, approximation};
+                }
+
+                size_t maximum_steps = std::max(this->maximum_precision(), other.maximum_precision());
+                auto this_rational = std::get_if<real_rational<T>>(&this->_real_p->get_real_number());
+                auto other_rational = std::get_if<real_rational<T>>(&other._real_p->get_real_number());
+
+                if (this_rational != nullptr && other_rational != nullptr) {
+                    ORDERING ordering = ORDERING::EQUAL;
+                    if (!(*this_rational == *other_rational)) {
+                        ordering = (*this_rational < *other_rational) ? ORDERING::LESS : ORDERING::GREATER;
+                    }
+                    return {BUDGET_STATUS::DECIDED, ordering, this->current_interval(), other.current_interval()};
+                }
+
+                if (other_rational != nullptr) {
+                    return this->compare_with_rational(other, maximum_steps, progress);
+                }
+
+                if (this_rational != nullptr) {
+                    budgeted_comparison<T> result = other.compare_with_rational(*this, maximum_steps, progress);
+                    std::swap(result.this_approximation, result.other_approximation);
+                    if (result.ordering == ORDERING::LESS) {
+                        result.ordering = ORDERING::GREATER;
+                    } else if (result.ordering == ORDERING::GREATER) {
+                        result.ordering = ORDERING::LESS;
+                    }
+                    return result;
+                }
+
+                // only one of the nodes is locked at a time, see real_data
+                auto this_it = this->refined_itr();
+                auto other_it = other.refined_itr();
+
+                while (true) {
+                    const interval<T> this_interval = this_it.get_interval();
+                    const interval<T> other_interval = other_it.get_interval();
+
+                    if (this_interval < other_interval) {
+                        return {BUDGET_STATUS::DECIDED, ORDERING::LESS, this_interval, other_interval};
+                    }
+                    if (other_interval < this_interval) {
+                        return {BUDGET_STATUS::DECIDED, ORDERING::GREATER, this_interval, other_interval};
+                    }
+
+                    // the intervals overlap, so if both are single numbers they are the same number
+                    bool this_done = this_interval.is_a_number() || this_it.get_precision() > maximum_steps;
+                    bool other_done = other_interval.is_a_number() || other_it.get_precision() > maximum_steps;
+                    if (this_interval.is_a_number() && other_interval.is_a_number()) {
+                        return {BUDGET_STATUS::DECIDED, ORDERING::EQUAL, this_interval, other_interval};
+                    }
+                    if ((this_done && other_done) || progress.exhausted(this_interval) || progress.exhausted(other_interval)) {
+                        return {BUDGET_STATUS::UNDECIDED, ORDERING::EQUAL, this_interval, other_interval};
+                    }
+
+                    bool refine_this = other_done || (!this_done &&
+                        this_interval.upper_bound - this_interval.lower_bound >= other_interval.upper_bound - other_interval.lower_bound);
+                    if (refine_this) {
+                        this_it = this->refine(maximum_steps);
+                    } else {
+                        other_it = other.refine(maximum_steps);
+                    }
+                    progress.refinements++;
+                }
+            }
+
+            /*
+             * A copy of the precision iterator of the node, which keeps the most precise approximation
+             * computed so far for the number, so comparing or printing it again starts from there. The
+             * first approximation of some operations is too coarse to be trusted, so it is refined at
+             * least once.
+             */
+            const_precision_iterator<T> refined_itr() const {
+                return _real_p->with_precision_itr([](const_precision_iterator<T>& it) {
+                    if (it.get_precision() < 2) {
+                        ++it;
+                    }
+                    return it;
+                });
+            }
+
+            /*
+             * Refines the node's precision iterator once, and returns a copy of it. A refinement is one
+             * precision step, or more with the REFINEMENT::DOUBLING schedule of the current context,
+             * up to maximum_steps + 1.
+             */
+            const_precision_iterator<T> refine(size_t maximum_steps) const {
+                return _real_p->with_precision_itr([maximum_steps](const_precision_iterator<T>& it) {
+                    size_t steps = evaluation_context::refinement_steps(it.get_precision(), maximum_steps);
+                    if (steps == 1) {
+                        ++it;
+                    } else {
+                        it.iterate_n_times(steps);
+                    }
+                    return it;
+                });
+            }
+
+            /*
+             * Runs f on run, or if run is empty on the pool of the current context, or else on a new
+             * thread. f runs with a copy of the current context, and its result or exception is set
+             * on the returned future.
+             */
+            template <typename R, typename F>
+            static std::future<R> run_async(const executor& run, F f) {
+                auto promise = std::make_shared<std::promise<R>>();
+                std::future<R> result = promise->get_future();
+
+                const evaluation_context* current = evaluation_context::current();
+                std::optional<evaluation_context> context;
+                if (current != nullptr) {
+                    context = *current;
+                }
+
+                std::function<void()> task = [promise, context, f = std::move(f)] {
+                    evaluation_context::scope scope(context ? &*context : nullptr);
+                    try {
+                        promise->set_value(f());
+                    } catch (...) {
+                        promise->set_exception(std::current_exception());
+                    }
+                };
+
+                if (run) {
+                    run(std::move(task));
+                } else if (context && context->pool) {
+                    context->pool->submit(std::move(task));
+                } else {
+                    std::thread(std::move(task)).detach();
+                }
+                return result;
+            }
+
+            // rebalances the number if its depth exceeds rebalance_depth
+            void rebalance_if_needed() {
+                if (rebalance_depth && _real_p->depth() > *rebalance_depth) {
+                    rebalance();
+                }
+            }
+
         public:
             /// @TODO: Move constructors to move directly from the ctors in real_explicit to the values in real_data
             /// @TODO: do we need different ctors to be more efficient? rvalue AND lvalue ref?
@@ -105,7 +378,7 @@ namespace boost {
                     auto [integer_part, decimal_part, exponent, positive] = exact_number<>::number_from_string(number);
 
                     if ((int)(decimal_part.length() + integer_part.length()) <= exponent) {
-                        this->_real_p = std::make_shared<real_data<T>>(real_explicit<T>(integer_part, decimal_part, exponent, positive));
+                        this->_real_p = real_node_table<T>::make_explicit(real_explicit<T>(integer_part, decimal_part, exponent, positive));
                     } else {
                         int zeroes = decimal_part.length() + integer_part.length() - exponent;
                         std::string denominator = "1";
@@ -116,19 +389,19 @@ namespace boost {
                         std::string numerator = (std::string) std::string(integer_part).c_str() + (std::string) std::string(decimal_part);
                         if (!positive)
                             numerator = "-" + numerator;
-                        std::shared_ptr<real_data<T>> lhs = std::make_shared<real_data<T>>(real_explicit<T>(numerator));
-                        std::shared_ptr<real_data<T>> rhs = std::make_shared<real_data<T>>(real_explicit<T>(denominator));
+                        std::shared_ptr<real_data<T>> lhs = real_node_table<T>::make_explicit(real_explicit<T>(numerator));
+                        std::shared_ptr<real_data<T>> rhs = real_node_table<T>::make_explicit(real_explicit<T>(denominator));
         
-                        this->_real_p  = std::make_shared<real_data<T>>(real_operation(lhs, rhs, OPERATION::DIVISION));
+                        this->_real_p  = real_node_table<T>::make_operation(real_operation(lhs, rhs, OPERATION::DIVISION));
                     }
                 }
                 if(type=="integer"){
                     integer_number<T> a(number);
                     integer_number<T> b("1");
-                    this->_real_p = std::make_shared<real_data<T>>(real_rational<T>(a,b));
+                    this->_real_p = make_real_data<T>(real_rational<T>(a,b));
                 }
                 if(type=="rational"){
-                    this->_real_p = std::make_shared<real_data<T>>(real_rational<T>(number));
+                    this->_real_p = make_real_data<T>(real_rational<T>(number));
                 }
             }
 
@@ -141,7 +414,7 @@ namespace boost {
                         auto [integer_part, decimal_part, exponent, positive] = exact_number<>::number_from_string(number);
 
                         if ((int)(decimal_part.length() + integer_part.length()) <= exponent) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_explicit<T>(integer_part, decimal_part, exponent, positive));
+                            this->_real_p = real_node_table<T>::make_explicit(real_explicit<T>(integer_part, decimal_part, exponent, positive));
                         } else {
                             int zeroes = decimal_part.length() + integer_part.length() - exponent;
                             std::string denominator = "1";
@@ -152,10 +425,10 @@ namespace boost {
                             std::string numerator = (std::string) std::string(integer_part).c_str() + (std::string) std::string(decimal_part);
                             if (!positive)
                                 numerator = "-" + numerator;
-                            std::shared_ptr<real_data<T>> lhs = std::make_shared<real_data<T>>(real_explicit<T>(numerator));
-                            std::shared_ptr<real_data<T>> rhs = std::make_shared<real_data<T>>(real_explicit<T>(denominator));
+                            std::shared_ptr<real_data<T>> lhs = real_node_table<T>::make_explicit(real_explicit<T>(numerator));
+                            std::shared_ptr<real_data<T>> rhs = real_node_table<T>::make_explicit(real_explicit<T>(denominator));
             
-                            this->_real_p  = std::make_shared<real_data<T>>(real_operation(lhs, rhs, OPERATION::DIVISION));
+                            this->_real_p  = real_node_table<T>::make_operation(real_operation(lhs, rhs, OPERATION::DIVISION));
                         }
                         break;
                     }
@@ -163,11 +436,11 @@ namespace boost {
                     case TYPE::INTEGER:{
                         integer_number<T> a(number);
                         integer_number<T> b("1");
-                        this->_real_p = std::make_shared<real_data<T>>(real_rational<T>(a,b));
+                        this->_real_p = make_real_data<T>(real_rational<T>(a,b));
                         break;
                     }
                     case TYPE::RATIONAL:{
-                        this->_real_p = std::make_shared<real_data<T>>(real_rational<T>(number));
+                        this->_real_p = make_real_data<T>(real_rational<T>(number));
                         break;
                     }
                     default:
@@ -182,7 +455,7 @@ namespace boost {
              * @param digits - a initializer_list<T> that represents the number digits.
              */
             real(std::initializer_list<T> digits)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, digits.size())))
+                    : _real_p(real_node_table<T>::make_explicit(real_explicit<T>(digits, digits.size())))
                 {};
 
             /**
@@ -196,7 +469,7 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(std::initializer_list<T> digits, bool positive)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, digits.size(), positive)))
+                    : _real_p(real_node_table<T>::make_explicit(real_explicit<T>(digits, digits.size(), positive)))
                     {};
 
             /**
@@ -209,7 +482,7 @@ namespace boost {
              * @param exponent - an integer representing the number exponent.
              */
             real(std::initializer_list<T> digits, int exponent)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, exponent)))
+                    : _real_p(real_node_table<T>::make_explicit(real_explicit<T>(digits, exponent)))
                     {};
 
             /**
@@ -224,7 +497,7 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(std::initializer_list<T> digits, int exponent, bool positive)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, exponent, positive)))
+                    : _real_p(real_node_table<T>::make_explicit(real_explicit<T>(digits, exponent, positive)))
                     {};
 
             /**
@@ -238,7 +511,7 @@ namespace boost {
              * @param exponent - an integer representing the number exponent.
              */
             real(T (*get_nth_digit)(unsigned int), int exponent)
-                    : _real_p(std::make_shared<real_data<T>>(real_algorithm<T>(get_nth_digit, exponent)))
+                    : _real_p(make_real_data<T>(real_algorithm<T>(get_nth_digit, exponent)))
                     {};
 
             /**
@@ -255,12 +528,12 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(T (*get_nth_digit)(unsigned int), int exponent, bool positive) 
-                 : _real_p(::std::make_shared<real_data<T>>(real_algorithm<T>(get_nth_digit, exponent, positive))) {};
+                 : _real_p(make_real_data<T>(real_algorithm<T>(get_nth_digit, exponent, positive))) {};
 
             // ctors from the 3 underlying types
-            real(real_explicit<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
-            real(real_algorithm<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
-            real(real_operation<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
+            real(real_explicit<T> x) : _real_p(real_node_table<T>::make_explicit(x)) {};
+            real(real_algorithm<T> x) : _real_p(make_real_data<T>(x)) {};
+            real(real_operation<T> x) : _real_p(real_node_table<T>::make_operation(x)) {};
 
             /**
              * @brief Default destructor
@@ -271,8 +544,13 @@ namespace boost {
                 return _real_p->get_real_number();
             }
 
+            /**
+             * @brief Returns a copy of the precision iterator of the number's node. The node's
+             * iterator keeps the most precise approximation computed so far by comparing or printing
+             * the number, so the copy may be past cbegin.
+             */
             const_precision_iterator<T> get_real_itr() const {
-                return _real_p->get_precision_itr();
+                return _real_p->with_precision_itr([](const_precision_iterator<T>& it) { return it; });
             }
 
             /**
@@ -285,9 +563,157 @@ namespace boost {
                 return get_real_itr().maximum_precision();
             }
 
+            /**
+             * @brief Iterates the number up to precision, or up to its maximum precision if lower,
+             * unless the budget runs out first.
+             *
+             * @param precision - the precision to reach.
+             * @param budget - the limits of the evaluation.
+             * @return the most precise approximation interval reached, and its precision. The status
+             * is BUDGET_STATUS::UNDECIDED if the budget ran out before reaching precision.
+             */
+            budgeted_evaluation<T> evaluate(size_t precision, const evaluation_budget& budget = {}) const {
+                precision = std::min<size_t>(precision, this->maximum_precision());
+                budget_progress progress{&budget};
+
+                auto it = this->get_real_itr();
+                while (it.get_precision() < precision) {
+                    if (progress.exhausted(it.get_interval())) {
+                        return {BUDGET_STATUS::UNDECIDED, it.get_interval(), it.get_precision()};
+                    }
+                    it = this->refine(precision - 1);
+                    progress.refinements++;
+                }
+                return {BUDGET_STATUS::DECIDED, it.get_interval(), it.get_precision()};
+            }
+
+            /**
+             * @brief Iterates the number up to precision, or up to its maximum precision if lower,
+             * on another thread.
+             *
+             * @details The nodes of the number are locked while they are iterated, so the number
+             * and the numbers sharing its nodes may still be used meanwhile. The evaluation uses the
+             * evaluation_context of the calling thread.
+             *
+             * @param precision - the precision to reach.
+             * @param observer - if set, called with each approximation interval and its precision as
+             * they tighten, on the thread of the evaluation.
+             * @param run - the executor of the evaluation. If empty, the pool of the current context
+             * is used, or else a new thread.
+             * @return the approximation interval at that precision.
+             */
+            std::future<interval<T>> evaluate_async(size_t precision,
+                                                    std::function<void(const interval<T>&, size_t)> observer = {},
+                                                    const executor& run = {}) const {
+                real<T> number = *this;
+                return run_async<interval<T>>(run, [number, precision, observer] {
+                    size_t target = std::min<size_t>(precision, number.maximum_precision());
+                    auto it = number.get_real_itr();
+                    while (it.get_precision() < target) {
+                        it = number.refine(target - 1);
+                        if (observer) {
+                            observer(it.get_interval(), it.get_precision());
+                        }
+                    }
+                    return it.get_interval();
+                });
+            }
+
+            /**
+             * @brief compare(other) on another thread, see evaluate_async.
+             *
+             * @return the ordering of *this and other. The future throws a precision_exception if
+             * they could not be ordered.
+             */
+            std::future<ORDERING> compare_async(const real<T>& other, const executor& run = {}) const {
+                real<T> number = *this;
+                return run_async<ORDERING>(run, [number, other] {
+                    return number.compare(other);
+                });
+            }
+
             /// set max precision for the underlying iterator
             void set_maximum_precision(unsigned int maximum_precision) {
-                this->_real_p->get_precision_itr().set_maximum_precision(maximum_precision);
+                this->_real_p->with_precision_itr([maximum_precision](const_precision_iterator<T>& it) {
+                    it.set_maximum_precision(maximum_precision);
+                });
+            }
+
+            /**
+             * @brief the depth of the operation tree of the number, 0 for explicit, algorithmic and rational numbers.
+             */
+            size_t depth() const {
+                return _real_p->depth();
+            }
+
+            /**
+             * @brief if set, the numbers created by +, -, * and their compound assignments are rebalanced
+             * when the depth of their tree exceeds this value. Unset by default.
+             */
+            inline static std::optional<size_t> rebalance_depth;
+
+            /**
+             * @brief Rebuilds the chain of additions and subtractions, or of multiplications, at the root
+             * of the number as a balanced tree.
+             *
+             * Accumulating with a += b produces a left deep tree whose depth is the number of terms,
+             * so the evaluation recurses that deep and the rounding errors pile up along a single path.
+             * The terms of the chain are collected in order and summed (or multiplied) pairwise, which
+             * leaves a tree of logarithmic depth with the same operands. Subtracted terms are summed
+             * apart and subtracted once at the end.
+             *
+             * The operands of the chain are not modified, so other numbers sharing them are not affected.
+             */
+            void rebalance() {
+                auto op_ptr = std::get_if<real_operation<T>>(&_real_p->get_real_number());
+                if (op_ptr == nullptr) {
+                    return;
+                }
+
+                OPERATION op = op_ptr->get_operation();
+                bool additive = (op == OPERATION::ADDITION || op == OPERATION::SUBTRACTION);
+                if (!additive && op != OPERATION::MULTIPLICATION) {
+                    return;
+                }
+
+                std::vector<std::shared_ptr<real_data<T>>> added;
+                std::vector<std::shared_ptr<real_data<T>>> subtracted;
+
+                // walk the chain without recursion, the tree may be as deep as it is long
+                std::vector<std::pair<std::shared_ptr<real_data<T>>, bool>> pending = {{_real_p, true}};
+                while (!pending.empty()) {
+                    auto [node, is_added] = pending.back();
+                    pending.pop_back();
+
+                    auto node_op = std::get_if<real_operation<T>>(&node->get_real_number());
+                    if (node_op != nullptr && additive && node_op->get_operation() == OPERATION::ADDITION) {
+                        pending.emplace_back(node_op->rhs(), is_added);
+                        pending.emplace_back(node_op->lhs(), is_added);
+                    } else if (node_op != nullptr && additive && node_op->get_operation() == OPERATION::SUBTRACTION) {
+                        pending.emplace_back(node_op->rhs(), !is_added);
+                        pending.emplace_back(node_op->lhs(), is_added);
+                    } else if (node_op != nullptr && !additive && node_op->get_operation() == OPERATION::MULTIPLICATION) {
+                        pending.emplace_back(node_op->rhs(), true);
+                        pending.emplace_back(node_op->lhs(), true);
+                    } else if (is_added) {
+                        added.push_back(node);
+                    } else {
+                        subtracted.push_back(node);
+                    }
+                }
+
+                OPERATION chain = additive ? OPERATION::ADDITION : OPERATION::MULTIPLICATION;
+                if (subtracted.empty()) {
+                    _real_p = balanced_tree(added, 0, added.size(), chain);
+                } else if (added.empty()) {
+                    auto zero = real_node_table<T>::make_explicit(real_explicit<T>("0"));
+                    auto rhs = balanced_tree(subtracted, 0, subtracted.size(), chain);
+                    _real_p = real_node_table<T>::make_operation(real_operation<T>(zero, rhs, OPERATION::SUBTRACTION));
+                } else {
+                    auto lhs = balanced_tree(added, 0, added.size(), chain);
+                    auto rhs = balanced_tree(subtracted, 0, subtracted.size(), chain);
+                    _real_p = real_node_table<T>::make_operation(real_operation<T>(lhs, rhs, OPERATION::SUBTRACTION));
+                }
             }
 
             /************** Operators ******************/
@@ -445,7 +871,7 @@ namespace boost {
                             }
 
                             if(assign_and_return_void) {
-                                this->_real_p = std::make_shared<real_data<T>>(real_operation<T>(a_op_b._real_p, x, OPERATION::MULTIPLICATION));
+                                this->_real_p = real_node_table<T>::make_operation(real_operation<T>(a_op_b._real_p, x, OPERATION::MULTIPLICATION));
                                 return std::make_pair(true, std::nullopt);
                             } else {
                                 return std::make_pair(true, real(real_operation<T>(a_op_b._real_p, x, OPERATION::MULTIPLICATION)));
@@ -495,7 +921,7 @@ namespace boost {
                             }
 
                             if(assign_and_return_void) {
-                                this->_real_p = std::make_shared<real_data<T>>(real_operation<T>(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
+                                this->_real_p = real_node_table<T>::make_operation(real_operation<T>(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
                                 return std::make_pair(true, std::nullopt);
                             } else {
                                 return std::make_pair(true, real(real_operation<T>(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
@@ -546,7 +972,7 @@ namespace boost {
                         }
 
                         if(assign_and_return_void) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
+                            this->_real_p = real_node_table<T>::make_operation(real_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
                             return std::make_pair(true, std::nullopt);
                         } else {
                             return std::make_pair(true, real(real_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
@@ -554,10 +980,10 @@ namespace boost {
                     }
                 } else { // neither is an operation
                     if ((this->_real_p == other._real_p) && (op == OPERATION::ADDITION)) { // a + a = 2 * a
-                        std::shared_ptr<real_data<T>> two = std::make_shared<real_data<T>>(real_explicit<T>("2"));
+                        std::shared_ptr<real_data<T>> two = real_node_table<T>::make_explicit(real_explicit<T>("2"));
 
                         if(assign_and_return_void) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION));
+                            this->_real_p = real_node_table<T>::make_operation(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION));
                             return std::make_pair(true, std::nullopt);
                         } else {
                             return std::make_pair(true, real(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION)));
@@ -579,7 +1005,7 @@ namespace boost {
                         if (!is_simplified) {
                             real ret = (*this);
                             ret._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, op));
+                                real_node_table<T>::make_operation(real_operation(this->_real_p, other._real_p, op));
                             return ret;
                         } else {
                             return result.value();
@@ -590,7 +1016,7 @@ namespace boost {
                     case RECURSION_LEVEL::ZERO: {
                         real ret = (*this);
                         ret._real_p = 
-                            std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, op));
+                            real_node_table<T>::make_operation(real_operation(this->_real_p, other._real_p, op));
                         return ret;
                         break;
                     }
@@ -697,25 +1123,31 @@ namespace boost {
             }
 
             /*      SQAURE ROOT METHOD
-             *  @brief:  Calculates real_num^(1/2) or sqrt(real_num)
+             *  @brief:  Calculates real_num^(1/2) or sqrt(real_num), by Newton's method on the bounds
+             *  of real_num, so that the square root of a perfect square is exact.
              *  @params: real_num: boost real number whose sqaure root is to be evaluated
-             *  @return: returns a new boost real whose value is real_num^exponent
+             *  @return: returns a new boost real whose value is sqrt(real_num)
+             *  @throws: boost::real::sqrt_not_defined_for_negative_number if real_num < 0
              *  @author: Vikram Singh Chundawat
              */
 
             static real sqrt(real<T> real_num){
-                real<T> power("1/2", TYPE::RATIONAL);
-                real<T> zero("0");
-                real<T> result;
-                try{
-                    result = real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::LOGARITHM));
-                    result = real(real_operation<T>(result._real_p, power._real_p, OPERATION::MULTIPLICATION));
-                    result = real(real_operation<T>(result._real_p, zero._real_p, OPERATION::EXPONENT));
-                }
-                catch(const logarithm_not_defined_for_non_positive_number& e){
-                    throw sqrt_not_defined_for_negative_number();
-                }
-                return result;
+                static real<T> zero("0");
+                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::SQRT));
+            }
+
+            /*      N-TH ROOT METHOD
+             *  @brief:  Calculates real_num^(1/n), see sqrt
+             *  @params: real_num: boost real number whose root is to be evaluated
+             *  @params: n: the degree of the root, a positive integer
+             *  @return: returns a new boost real whose value is real_num^(1/n)
+             *  @throws: boost::real::non_integral_exponent_exception if n is not an integer
+             *  @throws: boost::real::root_degree_out_of_range if n <= 0
+             *  @throws: boost::real::even_root_of_negative_number if n is even and real_num < 0
+             */
+
+            static real nth_root(real<T> real_num, real<T> n){
+                return real(real_operation<T>(real_num._real_p, n._real_p, OPERATION::NTH_ROOT));
             }
 
 
@@ -792,6 +1224,74 @@ namespace boost {
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COSEC));
             }
 
+            /**
+             *      ATAN METHOD
+             * @brief: Calculates atan(real_num), in radians, in (-π/2, π/2)
+             * @params: real_num: boost::real number whose atan is to be calculated.
+             * @return: returns a new boost::real which is atan(real_num)
+             **/
+            static real atan(real<T> real_num){
+                static real<T> zero("0");
+                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::ATAN));
+            }
+
+            /**
+             *      ASIN METHOD
+             * @brief: Calculates asin(real_num), in radians, in [-π/2, π/2]
+             * @params: real_num: boost::real number whose asin is to be calculated.
+             * @return: returns a new boost::real which is asin(real_num)
+             * @throws: boost::real::arcsine_not_defined_outside_unit_interval if real_num is not in [-1, 1]
+             **/
+            static real asin(real<T> real_num){
+                static real<T> zero("0");
+                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::ASIN));
+            }
+
+            /**
+             *      ACOS METHOD
+             * @brief: Calculates acos(real_num), in radians, in [0, π]
+             * @params: real_num: boost::real number whose acos is to be calculated.
+             * @return: returns a new boost::real which is acos(real_num)
+             * @throws: boost::real::arcsine_not_defined_outside_unit_interval if real_num is not in [-1, 1]
+             **/
+            static real acos(real<T> real_num){
+                static real<T> zero("0");
+                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::ACOS));
+            }
+
+            /**
+             *      SINH METHOD
+             * @brief: Calculates the hyperbolic sine of real_num
+             * @params: real_num: boost::real number whose sinh is to be calculated.
+             * @return: returns a new boost::real which is sinh(real_num)
+             **/
+            static real sinh(real<T> real_num){
+                static real<T> zero("0");
+                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::SINH));
+            }
+
+            /**
+             *      COSH METHOD
+             * @brief: Calculates the hyperbolic cosine of real_num
+             * @params: real_num: boost::real number whose cosh is to be calculated.
+             * @return: returns a new boost::real which is cosh(real_num)
+             **/
+            static real cosh(real<T> real_num){
+                static real<T> zero("0");
+                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COSH));
+            }
+
+            /**
+             *      TANH METHOD
+             * @brief: Calculates the hyperbolic tangent of real_num
+             * @params: real_num: boost::real number whose tanh is to be calculated.
+             * @return: returns a new boost::real which is tanh(real_num)
+             **/
+            static real tanh(real<T> real_num){
+                static real<T> zero("0");
+                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::TANH));
+            }
+
 
             /**
              * @brief Sets this real_data to that of the operation between this previous
@@ -806,7 +1306,7 @@ namespace boost {
                 std::visit( overloaded{ 
                     [this] (real_rational<T> a, real_rational<T> b){
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a+b));
+                            make_real_data<T>(real_rational<T>(a+b));
                     },
 
                     [this, &other] (real_rational<T> rat, auto tmp){
@@ -814,19 +1314,19 @@ namespace boost {
                         real<T> rat_num;
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                         
                             // if rational number is of rational type, then it would be converted to a division operation between two integers
                             real _a;
                             _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a)); 
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
                         
                         
@@ -834,7 +1334,7 @@ namespace boost {
                         auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
                         if(!is_simplified){
                             this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::ADDITION));
+                                real_node_table<T>::make_operation(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::ADDITION));
                         }
                     },
 
@@ -842,25 +1342,25 @@ namespace boost {
                         real<T> rat_num;
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real _a;
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         // now adding the numbers
                         auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
                         if(!is_simplified){
                             this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::ADDITION));
+                                real_node_table<T>::make_operation(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::ADDITION));
                         }
 
                     },
@@ -870,10 +1370,11 @@ namespace boost {
                         
                         if (!is_simplified) {
                             this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::ADDITION));
+                                real_node_table<T>::make_operation(real_operation<T>(this->_real_p, other._real_p, OPERATION::ADDITION));
                         }
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
+                rebalance_if_needed();
             }
 
             /**
@@ -888,7 +1389,7 @@ namespace boost {
                 std::visit( overloaded{
                     [&result] (real_rational<T> a, real_rational<T> b){
                         result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a+b));
+                            make_real_data<T>(real_rational<T>(a+b));
                     },
 
                     [this, &other, &result] (real_rational<T> rat, auto tmp){
@@ -898,17 +1399,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
@@ -926,17 +1427,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
@@ -956,6 +1457,7 @@ namespace boost {
                         }
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
+                result.rebalance_if_needed();
                 return result;
                 
             }
@@ -970,7 +1472,7 @@ namespace boost {
                 std::visit(overloaded{
                     [this] (real_rational<T> a, real_rational<T> b){
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a-b));
+                            make_real_data<T>(real_rational<T>(a-b));
                     },
 
                     [this, &other] (real_rational<T> rat, auto tmp){
@@ -978,19 +1480,19 @@ namespace boost {
                         real<T> rat_num;
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                         
                             // if rational number is of rational type, then it would be converted to a division operation between two integers
                             real _a;
                             _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a)); 
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
                         
                         
@@ -998,7 +1500,7 @@ namespace boost {
                         auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
                         if(!is_simplified){
                             this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::SUBTRACTION));
+                                real_node_table<T>::make_operation(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::SUBTRACTION));
                         }
                     },
 
@@ -1006,25 +1508,25 @@ namespace boost {
                         real<T> rat_num;
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real _a;
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         // now adding the numbers
                         auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
                         if(!is_simplified){
                             this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::SUBTRACTION));
+                                real_node_table<T>::make_operation(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::SUBTRACTION));
                         }
 
                     },
@@ -1034,11 +1536,12 @@ namespace boost {
 
                         if(!is_simplified) {
                             this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::SUBTRACTION));
+                                real_node_table<T>::make_operation(real_operation<T>(this->_real_p, other._real_p, OPERATION::SUBTRACTION));
                         }
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
                 
+                rebalance_if_needed();
             }
 
             /**
@@ -1053,7 +1556,7 @@ namespace boost {
                 std::visit( overloaded{
                     [&result] (real_rational<T> a, real_rational<T> b){
                         result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a-b));
+                            make_real_data<T>(real_rational<T>(a-b));
                     },
 
                     [this, &other, &result] (real_rational<T> rat, auto tmp){
@@ -1063,17 +1566,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
@@ -1091,17 +1594,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
@@ -1121,6 +1624,7 @@ namespace boost {
                         }
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
+                result.rebalance_if_needed();
                 return result;
             }
 
@@ -1134,7 +1638,7 @@ namespace boost {
                 std::visit(overloaded{
                     [this] (real_rational<T> a, real_rational<T> b){
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a*b));
+                            make_real_data<T>(real_rational<T>(a*b));
                     },
 
                     [this, &other] (real_rational<T> rat, auto tmp){
@@ -1142,59 +1646,60 @@ namespace boost {
                         real<T> rat_num;
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                         
                             // if rational number is of rational type, then it would be converted to a division operation between two integers
                             real _a;
                             _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a)); 
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
                         
                         
                         // now adding the numbers
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::MULTIPLICATION));
+                            real_node_table<T>::make_operation(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::MULTIPLICATION));
                     },
 
                     [this, &other] (auto tmp, real_rational<T> rat){
                         real<T> rat_num;
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real _a;
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         // now adding the numbers
                         
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::MULTIPLICATION));
+                            real_node_table<T>::make_operation(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::MULTIPLICATION));
 
                     },
 
 
                     [this, &other] (auto a, auto b){
                         this->_real_p =
-                        std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
+                        real_node_table<T>::make_operation(real_operation<T>(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
                 
+                rebalance_if_needed();
             }
 
             /**
@@ -1209,7 +1714,7 @@ namespace boost {
                 std::visit(overloaded{
                     [&result] (real_rational<T> a, real_rational<T> b){
                         result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a*b));
+                            make_real_data<T>(real_rational<T>(a*b));
                     },
 
                     [this, &other, &result] (real_rational<T> rat, auto tmp){
@@ -1219,17 +1724,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         
@@ -1244,17 +1749,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         
@@ -1266,6 +1771,7 @@ namespace boost {
                         result = real(real_operation<T>(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
                     }
                 }, _real_p->get_real_number(), other.get_real_number());
+                result.rebalance_if_needed();
                 return result;
             }
 
@@ -1282,7 +1788,7 @@ namespace boost {
                     [&result] (real_rational<T> a, real_rational<T> b){
                         real_rational<T> result1 = a/b;
                         result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational(result1));
+                            make_real_data<T>(real_rational(result1));
                     },
 
                     [this, &other, &result] (real_rational<T> rat, auto tmp){
@@ -1292,17 +1798,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         
@@ -1317,17 +1823,17 @@ namespace boost {
                         // if number is of integer type, rat_num will be converted to explicit number
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         
@@ -1352,7 +1858,7 @@ namespace boost {
                 std::visit(overloaded{
                     [this] (real_rational<T> a, real_rational<T> b){
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a/b));
+                            make_real_data<T>(real_rational<T>(a/b));
                     },
 
                     [this, &other] (real_rational<T> rat, auto tmp){
@@ -1360,55 +1866,55 @@ namespace boost {
                         real<T> rat_num;
                         if(rat.b == literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                         
                             // if rational number is of rational type, then it would be converted to a division operation between two integers
                             real _a;
                             _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a)); 
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
                         
                         
                         // now adding the numbers
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::DIVISION));
+                            real_node_table<T>::make_operation(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::DIVISION));
                     },
 
                     [this, &other] (auto tmp, real_rational<T> rat){
                         real<T> rat_num;
                         if(rat.b==literals::one_integer<T>){
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                         }
                         else{
                             real _a;
                             _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.a));
                             real _b;
                             _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
+                                real_node_table<T>::make_explicit(real_explicit<T>(rat.b));
 
                             rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                                real_node_table<T>::make_operation(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
                         }
 
                         // now adding the numbers
                         
                         this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::DIVISION));
+                            real_node_table<T>::make_operation(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::DIVISION));
 
                     },
 
                     [this, &other] (auto a, auto b){
                         this->_real_p =
-                            std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::DIVISION));
+                            real_node_table<T>::make_operation(real_operation<T>(this->_real_p, other._real_p, OPERATION::DIVISION));
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
                 
@@ -1428,7 +1934,63 @@ namespace boost {
              */
             void operator=(const std::string& number) {
                 this->_real_p =
-                    std::make_shared<real_data<T>>(real_explicit<T>(number));
+                    real_node_table<T>::make_explicit(real_explicit<T>(number));
+            }
+
+            /**
+             * @brief Three-way comparison of the *this boost::real::real number against the other
+             * boost::real::real number.
+             *
+             * The approximation intervals of both numbers are refined until they separate, or until
+             * both are a single number. At each step only the widest interval is refined, as it is
+             * the one that keeps them overlapping, and each number is refined at most
+             * max(this->maximum_precision(), other.maximum_precision()) times. Rational numbers are
+             * compared exactly, against other rationals with integer arithmetic and against any other
+             * number by comparing its bounds multiplied by the denominator with the numerator.
+             * The approximations are refined in the nodes of the numbers, so a later comparison or
+             * printing of either number continues from the precision reached here. Each node is locked
+             * while it is refined, so numbers sharing nodes may be compared from several threads.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @return ORDERING::LESS, ORDERING::EQUAL or ORDERING::GREATER if *this is lower than,
+             * equal to or greater than other.
+             *
+             * @throws boost::real::precision_exception if the maximum precision is reached and the
+             * intervals still overlap.
+             */
+            ORDERING compare(const real<T>& other) const {
+                budget_progress unlimited{nullptr};
+                budgeted_comparison<T> result = this->compare_within(other, unlimited);
+                if (result.status == BUDGET_STATUS::UNDECIDED) {
+                    throw boost::real::precision_exception();
+                }
+                return result.ordering;
+            }
+
+            /**
+             * @brief Three-way comparison as compare(other), that stops when the budget runs out.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @param budget - the limits of the comparison.
+             * @return the ordering of the numbers and their last approximation intervals. If the
+             * budget runs out, or the maximum precision is reached, before the intervals separate,
+             * the status is BUDGET_STATUS::UNDECIDED instead of throwing a precision_exception.
+             */
+            budgeted_comparison<T> compare(const real<T>& other, const evaluation_budget& budget) const {
+                budget_progress progress{&budget};
+                return this->compare_within(other, progress);
+            }
+
+            /**
+             * @brief Three-way comparison as compare(other), with the maximum precision and
+             * refinement schedule of context.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @param context - the boost::real::evaluation_context to compare with.
+             */
+            ORDERING compare(const real<T>& other, const evaluation_context& context) const {
+                evaluation_context::scope scope(context);
+                return this->compare(other);
             }
 
             /**
@@ -1443,175 +2005,7 @@ namespace boost {
              * @throws boost::real::precision_exception
              */
             bool operator<(const real<T>& other) const {
-                bool ret;
-                std::visit(overloaded{
-                    [&ret] (real_rational<T> a, real_rational<T> b){
-                        ret = (a<b);
-                    },
-
-                    [this, &other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this;
-                        if(rat_num.b == literals::one_integer<T>)
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-
-                        // now comparing numbers
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if(this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p){
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision){
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
-
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-
-                        // now comparing numbers
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if(this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p){
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision){
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
-
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
-                    [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
-
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                return ret;
-                
+                return this->compare(other) == ORDERING::LESS;
             }
 
             /**
@@ -1626,158 +2020,7 @@ namespace boost {
              * @throws boost::real::precision_exception
              */
             bool operator>(const real<T>& other) const {
-                bool ret;
-                std::visit(overloaded{
-                    [&ret] (real_rational<T> a, real_rational<T> b){
-                        ret = (a>b);
-                    },
-
-                    [&other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
-                    [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                return ret;
+                return this->compare(other) == ORDERING::GREATER;
             }
 
             /**
@@ -1787,153 +2030,37 @@ namespace boost {
              * the value of the result, a precision_exception is thrown.
              *
              * @param other - a boost::real::real number to compare against.
-             * @return a bool that is true if *this < other and false in other cases.
+             * @return a bool that is true if *this == other and false in other cases.
              *
              * @throws boost::real::precision_exception
              */
             bool operator == (const real<T>& other) const {
-                bool ret;
-                std::visit(overloaded{
-                    [&ret] (real_rational<T> a, real_rational<T> b){
-                        ret = (a==b);
-                    },
-
-                    [&other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this; // representing "other" number, which is a rational number
-                        if(rat_num.b==literals::one_integer<T>)   
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p==current_precision)
-                            throw boost::real::precision_exception();
-
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b==literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-                    },
-
-                    [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
+                return this->compare(other) == ORDERING::EQUAL;
+            }
 
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
+            /// *this != other, see boost::real::real::compare
+            bool operator != (const real<T>& other) const {
+                return this->compare(other) != ORDERING::EQUAL;
+            }
 
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
+            /// *this <= other, see boost::real::real::compare
+            bool operator <= (const real<T>& other) const {
+                return this->compare(other) != ORDERING::GREATER;
+            }
 
-                    } 
+            /// *this >= other, see boost::real::real::compare
+            bool operator >= (const real<T>& other) const {
+                return this->compare(other) != ORDERING::LESS;
+            }
 
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
+            /// the lowest of a and b, a if they are equal
+            static real<T> min(const real<T>& a, const real<T>& b) {
+                return (b.compare(a) == ORDERING::LESS) ? b : a;
+            }
 
-                return ret;
+            /// the greatest of a and b, a if they are equal
+            static real<T> max(const real<T>& a, const real<T>& b) {
+                return (b.compare(a) == ORDERING::GREATER) ? b : a;
             }
             /********* END OPERATORS *********/
 
@@ -1945,10 +2072,25 @@ namespace boost {
              * @return a reference of the modified os object.
              */
             friend std::ostream& operator<<(std::ostream& os, real r) {
-                os << r.get_real_itr().cend().get_interval();
+                os << r._real_p->with_precision_itr([](const_precision_iterator<T>& it) {
+                    return it.cend().get_interval();
+                });
                 return os;
             }
 
+            /**
+             * @brief prints the number as operator<<, at the maximum precision of context, unless
+             * the number sets its own.
+             *
+             * @param os - The std::ostream object where to print the number.
+             * @param context - the boost::real::evaluation_context to print with.
+             * @return a reference of the modified os object.
+             */
+            std::ostream& print(std::ostream& os, const evaluation_context& context) const {
+                evaluation_context::scope scope(context);
+                return os << *this;
+            }
+
 
         // to convert a real_integer type number to a real_explicit number
         void to_explicit(){
@@ -1958,7 +2100,7 @@ namespace boost {
                         throw expected_real_integer_type_number();
                     }
                     this->_real_p = 
-                        std::make_shared<real_data<T>>(real_explicit<T>(a.a));
+                        real_node_table<T>::make_explicit(real_explicit<T>(a.a));
                 },
                 [] (auto a){
                     throw expected_real_integer_type_number();
@@ -1976,12 +2118,12 @@ namespace boost {
                 [this] (real_rational<T> rat_num){
                     real _a, _b;
                     _a._real_p = 
-                        std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
+                        real_node_table<T>::make_explicit(real_explicit<T>(rat_num.a));
                     _b._real_p = 
-                        std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
+                        real_node_table<T>::make_explicit(real_explicit<T>(rat_num.b));
 
                     this->_real_p = 
-                        std::make_shared<real_data<T>>(real_operation<T>(_a, _b, OPERATION::DIVISION));
+                        real_node_table<T>::make_operation(real_operation<T>(_a, _b, OPERATION::DIVISION));
                 },
                 [] (auto tmp){
                     throw expected_real_rational_type_number();
@@ -1999,7 +2141,7 @@ namespace boost {
                     }
 
                     result._real_p = 
-                        std::make_shared<real_data<T>>(real_rational<T>(a.a % b.a));
+                        make_real_data<T>(real_rational<T>(a.a % b.a));
                 },
                 [] (auto a, auto b){
                     throw expected_real_integer_type_number();
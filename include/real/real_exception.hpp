@@ -141,6 +141,24 @@ namespace boost {
                 return "Square root function is not defined for negative numbers";
             }
         };
+
+        struct even_root_of_negative_number : public std::exception {
+            const char * what() const throw () override {
+                return "Even roots are not defined for negative numbers";
+            }
+        };
+
+        struct root_degree_out_of_range : public std::exception {
+            const char * what() const throw () override {
+                return "The degree of a root must be a positive integer, smaller than the base of the digits";
+            }
+        };
+
+        struct arcsine_not_defined_outside_unit_interval : public std::exception {
+            const char * what() const throw () override {
+                return "Arcsine and arccosine are only defined for numbers between -1 and 1";
+            }
+        };
         
 
     }
@@ -0,0 +1,209 @@
+#ifndef BOOST_REAL_REAL_EXPRESSION_HPP
+#define BOOST_REAL_REAL_EXPRESSION_HPP
+
+#include <memory>
+#include <type_traits>
+
+#include <real/real.hpp>
+#include <real/interval_arithmetic.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * The classes in this file are an opt-in expression template layer over boost::real::real.
+         * Wrapping an operand with boost::real::expr makes the arithmetic operators build a
+         * compile-time expression type instead of a new real_data per operator:
+         *
+         *      auto e = expr(a) * b + expr(c) * d;
+         *
+         * The expression holds its operands by value (a real is only a shared_ptr, so no allocation
+         * happens) and it can be:
+         *
+         *  1. approximated at a given precision, walking the expression type with the interval
+         *  kernels and never touching the heap for the operations, or
+         *
+         *  2. materialized into a boost::real::real, creating one real_operation per operator of
+         *  the expression and nothing else: the operands are neither copied nor simplified by
+         *  real::check_and_distribute.
+         *
+         * As the approximation runs at a fixed precision, a division whose divisor interval contains
+         * zero throws, see boost::real::interval_divide. Materialize the expression to get a number
+         * that iterates its operands as needed.
+         */
+
+        template <typename T, OPERATION op, typename L, typename R>
+        class real_binary_expression;
+
+        template <typename T>
+        class real_terminal;
+
+        template <typename E>
+        struct is_real_expression : std::false_type {};
+
+        template <typename T>
+        struct is_real_expression<real_terminal<T>> : std::true_type {};
+
+        template <typename T, OPERATION op, typename L, typename R>
+        struct is_real_expression<real_binary_expression<T, op, L, R>> : std::true_type {};
+
+        template <typename E>
+        inline constexpr bool is_real_expression_v = is_real_expression<std::decay_t<E>>::value;
+
+        /**
+         * @brief a boost::real::real used as an operand of an expression
+         */
+        template <typename T = int>
+        class real_terminal {
+        private:
+            real<T> _value;
+
+        public:
+            using value_type = T;
+
+            explicit real_terminal(const real<T>& value) : _value(value) {};
+
+            /// approximation interval of the operand at the given precision
+            interval<T> approximate(size_t precision) const {
+                const_precision_iterator<T> it = _value.get_real_itr();
+                if (it.get_precision() < precision) {
+                    it.iterate_n_times(precision - it.get_precision());
+                }
+                return it.get_interval();
+            }
+
+            /// the node of the operand, shared with the wrapped number
+            std::shared_ptr<real_data<T>> node() const {
+                return _value._real_p;
+            }
+
+            operator real<T>() const {
+                return _value;
+            }
+        };
+
+        /**
+         * @brief the operation op between two expressions
+         */
+        template <typename T, OPERATION op, typename L, typename R>
+        class real_binary_expression {
+        private:
+            L _lhs;
+            R _rhs;
+
+        public:
+            using value_type = T;
+
+            real_binary_expression(const L& lhs, const R& rhs) : _lhs(lhs), _rhs(rhs) {};
+
+            /**
+             * @brief computes the approximation interval of the expression at the given precision.
+             *
+             * @param precision - the precision the operands are approximated to and the operations rounded at.
+             * @return the approximation interval of the expression.
+             *
+             * @throws boost::real::divergent_division_result_exception if a divisor interval contains zero.
+             */
+            interval<T> approximate(size_t precision) const {
+                interval<T> lhs = _lhs.approximate(precision);
+                interval<T> rhs = _rhs.approximate(precision);
+
+                if constexpr (op == OPERATION::ADDITION) {
+                    return interval_add(lhs, rhs, precision);
+                } else if constexpr (op == OPERATION::SUBTRACTION) {
+                    return interval_subtract(lhs, rhs, precision);
+                } else if constexpr (op == OPERATION::MULTIPLICATION) {
+                    return interval_multiply(lhs, rhs, precision);
+                } else {
+                    static_assert(op == OPERATION::DIVISION, "unsupported expression operation");
+                    return interval_divide(lhs, rhs, precision);
+                }
+            }
+
+            /// builds the real_data tree of the expression, one node per operator
+            std::shared_ptr<real_data<T>> node() const {
+                std::shared_ptr<real_data<T>> lhs = _lhs.node();
+                std::shared_ptr<real_data<T>> rhs = _rhs.node();
+                return real_node_table<T>::make_operation(real_operation<T>(lhs, rhs, op));
+            }
+
+            /// materializes the expression into a boost::real::real
+            operator real<T>() const {
+                std::shared_ptr<real_data<T>> lhs = _lhs.node();
+                std::shared_ptr<real_data<T>> rhs = _rhs.node();
+                return real<T>(real_operation<T>(lhs, rhs, op));
+            }
+
+            /// materializes the expression into a boost::real::real
+            real<T> materialize() const {
+                return *this;
+            }
+        };
+
+        /**
+         * @brief wraps x so the operators applied to it build an expression template.
+         */
+        template <typename T>
+        real_terminal<T> expr(const real<T>& x) {
+            return real_terminal<T>(x);
+        }
+
+        namespace detail {
+            template <typename T>
+            real_terminal<T> as_expression(const real<T>& x) {
+                return real_terminal<T>(x);
+            }
+
+            template <typename E, typename = std::enable_if_t<is_real_expression_v<E>>>
+            const E& as_expression(const E& e) {
+                return e;
+            }
+
+            // an operator is an expression operator if one operand is an expression and the other
+            // one is an expression or a real of the same T
+            template <typename L, typename R>
+            constexpr bool is_expression_operation() {
+                if constexpr (!is_real_expression_v<L> && !is_real_expression_v<R>) {
+                    return false;
+                } else if constexpr (!is_real_expression_v<L> || !is_real_expression_v<R>) {
+                    using E = std::conditional_t<is_real_expression_v<L>, L, R>;
+                    using O = std::conditional_t<is_real_expression_v<L>, R, L>;
+                    return std::is_same_v<O, real<typename E::value_type>>;
+                } else {
+                    return std::is_same_v<typename L::value_type, typename R::value_type>;
+                }
+            }
+
+            template <OPERATION op, typename L, typename R>
+            auto make_expression(const L& lhs, const R& rhs) {
+                using E = std::conditional_t<is_real_expression_v<L>, L, R>;
+                using T = typename E::value_type;
+                auto l = as_expression(lhs);
+                auto r = as_expression(rhs);
+                return real_binary_expression<T, op, decltype(l), decltype(r)>(l, r);
+            }
+        }
+
+        template <typename L, typename R, typename = std::enable_if_t<detail::is_expression_operation<L, R>()>>
+        auto operator+(const L& lhs, const R& rhs) {
+            return detail::make_expression<OPERATION::ADDITION>(lhs, rhs);
+        }
+
+        template <typename L, typename R, typename = std::enable_if_t<detail::is_expression_operation<L, R>()>>
+        auto operator-(const L& lhs, const R& rhs) {
+            return detail::make_expression<OPERATION::SUBTRACTION>(lhs, rhs);
+        }
+
+        template <typename L, typename R, typename = std::enable_if_t<detail::is_expression_operation<L, R>()>>
+        auto operator*(const L& lhs, const R& rhs) {
+            return detail::make_expression<OPERATION::MULTIPLICATION>(lhs, rhs);
+        }
+
+        template <typename L, typename R, typename = std::enable_if_t<detail::is_expression_operation<L, R>()>>
+        auto operator/(const L& lhs, const R& rhs) {
+            return detail::make_expression<OPERATION::DIVISION>(lhs, rhs);
+        }
+    }
+}
+
+#endif // BOOST_REAL_REAL_EXPRESSION_HPP
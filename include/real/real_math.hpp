@@ -1,15 +1,409 @@
 #ifndef BOOST_REAL_MATH_HPP
 #define BOOST_REAL_MATH_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
 #include <tuple>
 #include "real/exact_number.hpp"
+#include "real/binary_splitting.hpp"
 #include "real/real_exception.hpp"
 
 namespace boost{
 	namespace real{
 		/**
-		 *  EXPONENT FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates exponent of a exact_number using taylor expansion
+		 * @brief: the number of bits of a digit of exact_number<T>, rounded down
+		 **/
+		template<typename T>
+		inline size_t digit_bits(){
+			return std::numeric_limits<T>::digits - 2;
+		}
+
+		/**
+		 * @brief: truncates x, keeping its digits down to base^(-max_error_exponent)
+		 * @param: x: the exact_number to truncate
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		inline exact_number<T> truncate(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			long significant_digits = (long)x.exponent + (long)max_error_exponent;
+			if(significant_digits <= 0){
+				return x;
+			}
+			return x.up_to(significant_digits, upper);
+		}
+
+		/**
+		 * @brief: the integer part of x, rounded toward zero
+		 **/
+		template<typename T>
+		inline exact_number<T> integer_part(const exact_number<T>& x){
+			if(x.exponent <= 0){
+				return literals::zero_exact<T>;
+			}
+			exact_number<T> result = x;
+			if(result.digits.size() > (size_t)result.exponent){
+				result.digits.resize(result.exponent);
+			}
+			return result;
+		}
+
+		/**
+		 * @brief: the number of terms of a taylor series to sum, so that the first term left out,
+		 * |x|^m / m! with m = first_power + step * terms, is lower than half base^(-max_error_exponent - 2),
+		 * and lower than the term before it, so that the terms left out keep decreasing.
+		 * @param: log2_x: log2|x|, see log2_estimate
+		 **/
+		template<typename T>
+		size_t series_terms(double log2_x, size_t max_error_exponent, size_t first_power, size_t step){
+			static const double log2_base = std::log2((double)((std::numeric_limits<T>::max() / 4) * 2));
+			const double target = -((double)max_error_exponent + 2) * log2_base - 1;
+			const double x = std::exp2(log2_x);
+
+			size_t terms = 0;
+			while(true){
+				double m = (double)(first_power + step * terms);
+				if(m > x && m * log2_x - std::lgamma(m + 1) / std::log(2.0) < target){
+					return terms;
+				}
+				++terms;
+			}
+		}
+
+		/**
+		 * @brief: the sum of a taylor series split by binary_splitting, with a bound of the terms
+		 * left out added to the upper bound or subtracted from the lower one. The terms are counted
+		 * by series_terms, so the ones left out sum less than base^(-max_error_exponent - 2) if they
+		 * alternate in sign or if each is at most half the previous one.
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> series_sum(const split_terms<T>& terms, size_t max_error_exponent, bool upper){
+			exact_number<T> rest(std::vector<T> {1}, -(max_error_exponent + 1), true);
+			exact_number<T> result = split_sum(terms, max_error_exponent + 1, upper);
+			if(upper){
+				result += rest;
+			}
+			else{
+				result -= rest;
+			}
+			return truncate(result, max_error_exponent + 2, upper);
+		}
+
+		/**
+		 *  EXPONENT SERIES FOR SMALL ARGUMENTS
+		 * @brief: calculates exponent of numerator/denominator, in [0, 1], summing the taylor series
+		 * by binary splitting.
+		 * @param: numerator, denominator: the integers whose quotient is the exponent
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> exponent_series(const exact_number<T>& numerator, const exact_number<T>& denominator, size_t max_error_exponent, bool upper){
+			if(numerator == literals::zero_exact<T>){
+				return literals::one_exact<T>;
+			}
+			// the terms x^n / n!, from n = 1
+			size_t terms = series_terms<T>(log2_estimate(numerator) - log2_estimate(denominator), max_error_exponent, 1, 1);
+			if(terms == 0){
+				return literals::one_exact<T>;
+			}
+			auto sum = binary_splitting<T>(1, terms + 1,
+				[&numerator](size_t){ return numerator; },
+				[&denominator](size_t k){ return denominator * integer_exact<T>(k); },
+				[](size_t){ return literals::one_exact<T>; });
+			return literals::one_exact<T> + series_sum(sum, max_error_exponent, upper);
+		}
+
+		/**
+		 *  N-TH ROOT FUNCTION BY NEWTON'S METHOD
+		 * @brief: calculates x^(1/n) of a exact_number. The root y of y^n = x is found by iterating
+		 * y = ((n - 1) y + x / y^(n - 1)) / n from an estimate in double, which doubles the correct
+		 * digits of y each time, so that the precision of the iteration is doubled too and the total
+		 * work is about a few divisions at the full precision. y is then moved on the grid of
+		 * base^(-max_error_exponent - 1) to the last point below the root (or the first above it),
+		 * comparing its n-th power with x exactly, so that the root of a perfect power is exact.
+		 * @param: x: the exact_number whose root is to be found, non negative if n is even
+		 * @param: n: the degree of the root, n > 0
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> nth_root(const exact_number<T>& x, unsigned long n, size_t max_error_exponent, bool upper){
+			if(n == 0){
+				throw root_degree_out_of_range();
+			}
+			if(x == literals::zero_exact<T> || n == 1){
+				return x;
+			}
+			if(!x.positive){
+				if(n % 2 == 0){
+					throw even_root_of_negative_number();
+				}
+				// the root of -x is minus the one of x, rounded the other way
+				exact_number<T> result = nth_root(x.abs(), n, max_error_exponent, !upper);
+				if(result != literals::zero_exact<T>){
+					result.positive = false;
+				}
+				return result;
+			}
+
+			static const T base = (std::numeric_limits<T>::max() / 4) * 2;
+			static const double log2_base = std::log2((double)base);
+			const exact_number<T> degree = integer_exact<T>((long long)n);
+			const exact_number<T> degree_minus_one = integer_exact<T>((long long)n - 1);
+
+			// the estimate, as three digits: x^(1/n) = 2^(log2(x)/n) = m * base^a, with m in [1, base)
+			double exponent_estimate = log2_estimate(x) / (double)n / log2_base;
+			double a = std::floor(exponent_estimate);
+			double m = std::pow(2.0, (exponent_estimate - a) * log2_base);
+			std::vector<T> estimate_digits;
+			for(int i = 0; i < 3; ++i){
+				T digit = (T)std::max(0.0, std::min((double)(base - 1), std::floor(m)));
+				estimate_digits.push_back(digit);
+				m = (m - (double)digit) * (double)base;
+			}
+			if(estimate_digits[0] == 0){
+				estimate_digits[0] = 1;
+			}
+			exact_number<T> y(estimate_digits, (int)a + 1, true);
+			y.normalize();
+
+			// the significant digits of y kept at each step, a few more than are correct. Each step doubles
+			// the correct bits, less the bits of n, and the estimate loses the bits of the exponent of x
+			const size_t bits = digit_bits<T>();
+			size_t grid = max_error_exponent + 1;
+			size_t target = (size_t)std::max((long)y.exponent + (long)grid + 1, 2L);
+			double correct_bits = 50 - std::log2(1 + std::fabs(log2_estimate(x)) / (double)n);
+			while(true){
+				size_t working_digits = std::min(target, (size_t)(2 * std::max(correct_bits, 1.0) / bits) + 2);
+				exact_number<T> power = exact_number<T>::binary_exponentiation(y, degree_minus_one).up_to(working_digits + 1, false);
+				exact_number<T> quotient = x;
+				quotient.divide_vector(power, working_digits + 1, false);
+				y = degree_minus_one * y + quotient;
+				y.divide_vector(degree, working_digits + 1, false);
+				y = y.up_to(working_digits + 1, false);
+
+				correct_bits = std::max(2 * correct_bits - std::log2((double)n) - 1, correct_bits + 1);
+				correct_bits = std::min(correct_bits, (double)((working_digits - 1) * bits));
+				if(working_digits == target && correct_bits >= (double)((target - 1) * bits)){
+					break;
+				}
+			}
+
+			// y is within a few steps of the grid from the root, the last of them are taken exactly
+			exact_number<T> step(std::vector<T> {1}, 1 - (int)grid, true);
+			y = truncate(y, grid, upper);
+			auto power_of = [&degree](const exact_number<T>& z){
+				return exact_number<T>::binary_exponentiation(z, degree);
+			};
+			if(upper){
+				while(power_of(y) < x){
+					y = y + step;
+				}
+				while(y >= step && power_of(y - step) >= x){
+					y = y - step;
+				}
+			}
+			else{
+				while(power_of(y) > x){
+					y = y - step;
+				}
+				while(power_of(y + step) <= x){
+					y = y + step;
+				}
+			}
+			return y;
+		}
+
+		/**
+		 *  SQUARE ROOT FUNCTION
+		 * @brief: calculates the square root of a exact_number, see nth_root
+		 * @param: x: the exact_number whose square root is to be found, x >= 0
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> square_root(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			if(!x.positive && x != literals::zero_exact<T>){
+				throw sqrt_not_defined_for_negative_number();
+			}
+			return nth_root(x, 2, max_error_exponent, upper);
+		}
+
+		/**
+		 * @brief: the series of ln((n+1)/(n-1)) = 2*atanh(1/n), for an integer n > 1, whose terms are
+		 * 2/((2k+1) n^(2k+1)), each the previous one times (2k-1)/((2k+1) n^2). ln 2 is the sum for
+		 * n = 3, and ln(5/4) for n = 9.
+		 * @param: n: the integer, greater than 1
+		 **/
+		template<typename T>
+		resumable_series<T> logarithm_ratio_series(long long n){
+			return resumable_series<T>(
+				[](size_t k){ return integer_exact<T>((k == 0) ? 2 : 2 * (long long)k - 1); },
+				[n](size_t k){ return integer_exact<T>((k == 0) ? n : (2 * (long long)k + 1) * n * n); },
+				[](size_t){ return integer_exact<T>(1); });
+		}
+
+		/**
+		 * @brief: ln((n+1)/(n-1)), summing as many terms of logarithm_ratio_series(n) as needed.
+		 * @param: series: logarithm_ratio_series(n), which keeps its terms for the next sums
+		 * @param: n: the integer, greater than 1
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> logarithm_ratio(resumable_series<T>& series, long long n, size_t max_error_exponent, bool upper){
+			static const double log2_base = std::log2((double)((std::numeric_limits<T>::max() / 4) * 2));
+			// the terms decrease by a factor of n^2 at least, so the terms left out sum less than the first of them
+			size_t terms = (size_t)(((double)max_error_exponent + 2) * log2_base / (2 * std::log2((double)n))) + 3;
+			return series_sum(series.terms(terms), max_error_exponent, upper);
+		}
+
+		/**
+		 * @brief: the series of Chudnovsky's formula, 426880 sqrt(10005) / π = the sum from k = 0 of
+		 * (6k)! (13591409 + 545140134k) / ((3k)! (k!)^3 (-640320)^(3k)). Less its linear factor, each
+		 * term is the previous one times -(6k-5)(2k-1)(6k-1) / (k^3 640320^3 / 24), so that each of
+		 * them is about 151931373056000 times smaller than the one before.
+		 **/
+		template<typename T>
+		resumable_series<T> chudnovsky_series(){
+			return resumable_series<T>(
+				[](size_t k){
+					long long kk = k;
+					return (k == 0) ? integer_exact<T>(1) : integer_exact<T>(-(6 * kk - 5) * (2 * kk - 1) * (6 * kk - 1));
+				},
+				[](size_t k){
+					long long kk = k;
+					// 640320^3 / 24
+					return (k == 0) ? integer_exact<T>(1) : integer_exact<T>(kk * kk * kk) * integer_exact<T>(10939058860032000);
+				},
+				[](size_t k){ return integer_exact<T>(13591409 + 545140134 * (long long)k); });
+		}
+
+		/**
+		 * @brief: a constant, computed once to the precision requested and again only when more
+		 * precision is requested, at least doubling the precision kept each time, so that asking
+		 * for more and more digits of it costs about as much as computing the last of them once.
+		 **/
+		template<typename T>
+		class cached_constant{
+			private:
+				// computes the lower or upper bound of the constant, within base^(-max_error_exponent)
+				std::function<exact_number<T>(size_t, bool)> _compute;
+				std::mutex _mutex;
+				size_t _precision = 0;
+				exact_number<T> _lower, _upper;
+
+				// the caller holds _mutex
+				void extend(size_t precision){
+					if(_precision < precision){
+						precision = std::max(precision, 2 * _precision);
+						_lower = _compute(precision, false);
+						_upper = _compute(precision, true);
+						_precision = precision;
+					}
+				}
+
+			public:
+				explicit cached_constant(std::function<exact_number<T>(size_t, bool)> compute) : _compute(std::move(compute)) {}
+
+				/**
+				 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+				 * @param:  upper: if true: error lies in [0, +epsilon]
+				 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+				 **/
+				exact_number<T> get(size_t max_error_exponent, bool upper){
+					std::lock_guard<std::mutex> lock(_mutex);
+					extend(max_error_exponent + 2);
+					return truncate(upper ? _upper : _lower, max_error_exponent + 2, upper);
+				}
+
+				/**
+				 * @brief: the n-th digit of the constant, counted from its first digit, read from the
+				 * kept lower bound without copying it.
+				 **/
+				T digit(size_t n){
+					std::lock_guard<std::mutex> lock(_mutex);
+					extend(n + 2);
+					return (n < _lower.digits.size()) ? _lower.digits[n] : 0;
+				}
+		};
+
+		/**
+		 * @brief: the registry of the constants π, e, ln 2 and ln 10. Each of them is a sum of series
+		 * whose terms are kept, so that extending its precision resumes the binary splitting where
+		 * it stopped, and its digits are read from the cache, see cached_constant.
+		 **/
+		template<typename T>
+		struct constants{
+			/// e, the sum of 1/k! from k = 0
+			static cached_constant<T>& e(){
+				static resumable_series<T> series(
+					[](size_t){ return integer_exact<T>(1); },
+					[](size_t k){ return integer_exact<T>((k == 0) ? 1 : (long long)k); },
+					[](size_t){ return integer_exact<T>(1); });
+				static cached_constant<T> constant([](size_t precision, bool upper){
+					return series_sum(series.terms(series_terms<T>(0, precision, 0, 1)), precision, upper);
+				});
+				return constant;
+			}
+
+			/// ln 2 = 2 atanh(1/3)
+			static cached_constant<T>& ln_two(){
+				static resumable_series<T> series = logarithm_ratio_series<T>(3);
+				static cached_constant<T> constant([](size_t precision, bool upper){
+					return logarithm_ratio(series, 3, precision, upper);
+				});
+				return constant;
+			}
+
+			/// ln 10 = 3 ln 2 + ln(5/4), with ln(5/4) = 2 atanh(1/9)
+			static cached_constant<T>& ln_ten(){
+				static resumable_series<T> series = logarithm_ratio_series<T>(9);
+				static cached_constant<T> constant([](size_t precision, bool upper){
+					return integer_exact<T>(3) * ln_two().get(precision + 1, upper) + logarithm_ratio(series, 9, precision + 1, upper);
+				});
+				return constant;
+			}
+
+			/// π = 426880 sqrt(10005) / S, with S the sum of chudnovsky_series
+			static cached_constant<T>& pi(){
+				static resumable_series<T> series = chudnovsky_series<T>();
+				// 426880 sqrt(10005), extended along with π
+				static cached_constant<T> factor([](size_t precision, bool upper){
+					return integer_exact<T>(426880) * square_root(integer_exact<T>(10005), precision + 1, upper);
+				});
+				static cached_constant<T> constant([](size_t precision, bool upper){
+					static const double log2_base = std::log2((double)((std::numeric_limits<T>::max() / 4) * 2));
+					// the terms alternate in sign and lose 47 bits each, so the terms left out sum less than
+					// the first of them, which is lower than base^(-precision - 5)
+					size_t terms = (size_t)((((double)precision + 5) * log2_base + 64) / 47) + 1;
+					exact_number<T> result = factor.get(precision + 3, upper);
+					result.divide_vector(series_sum(series.terms(terms), precision + 3, !upper), precision + 3, upper);
+					return result;
+				});
+				return constant;
+			}
+		};
+
+		/**
+		 *  EXPONENT FUNCTION WITH ARGUMENT REDUCTION
+		 * @brief: calculates exponent of a exact_number. The argument is split as n + f, with n an
+		 * integer and f in [0, 1). e^n is the cached e raised to n, and e^f is (e^(f/2^k))^(2^k), where
+		 * f/2^k is small enough for the taylor series to need few terms. k grows with the square root
+		 * of the precision, so the number of terms does too, instead of growing with num.
+		 * e^(-x) is 1/e^x.
 		 * @param: num: the exact number. whose exponent is to be found
 		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
 		 * @param:  upper: if true: error lies in [0, +epsilon]
@@ -18,27 +412,93 @@ namespace boost{
 		 **/
 		template<typename T>
 		exact_number<T> exponent(exact_number<T> num, size_t max_error_exponent, bool upper){
+			if(num == literals::zero_exact<T>){
+				return literals::one_exact<T>;
+			}
+
+			if(!num.positive){
+				// e^x > 1 for x > 0, so the error of e^x is reduced by the division, and a bound of e^x
+				// gives the opposite bound of e^(-x)
+				num.positive = true;
+				exact_number<T> result("1");
+				result.divide_vector(exponent(num, max_error_exponent + 2, !upper), max_error_exponent + 2, upper);
+				return truncate(result, max_error_exponent + 2, upper);
+			}
+
+			static const T base = (std::numeric_limits<T>::max() / 4) * 2;
+			const size_t bits = digit_bits<T>();
+
+			// num = integer + fraction
+			exact_number<T> integer = integer_part(num);
+			exact_number<T> fraction = num - integer;
+
+			unsigned long long n = 0;
+			if(integer != literals::zero_exact<T>){
+				for(int i = 0; i < integer.exponent; ++i){
+					T digit = (i < (int)integer.digits.size()) ? integer.digits[i] : 0;
+					n = n * base + digit;
+				}
+			}
+
+			// f/2^k < 2^(-sqrt(precision bits)), counting the leading zeros of f
+			size_t precision_bits = max_error_exponent * bits;
+			long k = (long)std::sqrt((double)precision_bits);
+			if(fraction.exponent < 0){
+				k -= (long)(-fraction.exponent) * bits;
+			}
+			k = std::max(k, 0L);
+
+			// the digits of e^n before the point, and guard digits for the 2^k times growth of the
+			// error of e^(f/2^k) when squaring, and for the n multiplications of e
+			size_t magnitude = (size_t)(n * 1.4426950408889634 / bits) + 1;
+			size_t n_bits = 0;
+			while((n >> n_bits) > 0){
+				++n_bits;
+			}
+			size_t working_precision = max_error_exponent + 2 * magnitude + (k + n_bits + 8) / bits + 2;
+
 			exact_number<T> result("1");
-			exact_number<T> term_number("1");
-			exact_number<T> factorial("1");
-			exact_number<T> cur_term("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			exact_number<T> x_pow("1");
-			do{
-				result += cur_term;
-				factorial *= term_number;
-				term_number = term_number + literals::one_exact<T>;
-				x_pow *= num;
-				cur_term = x_pow;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
-			return result;
+			if(fraction != literals::zero_exact<T>){
+				exact_number<T> two_k("1");
+				for(long i = 0; i < k; ++i){
+					two_k = two_k * literals::two_exact<T>;
+				}
+				// f/2^k, as a fraction of integers
+				auto [numerator, denominator] = as_fraction(fraction);
+				result = exponent_series(numerator, denominator * two_k, working_precision, upper);
+				for(long i = 0; i < k; ++i){
+					result = truncate(result * result, working_precision, upper);
+				}
+			}
+
+			if(n > 0){
+				// e^n by repeated squaring
+				exact_number<T> power = constants<T>::e().get(working_precision, upper);
+				exact_number<T> integer_exponent("1");
+				while(true){
+					if(n & 1){
+						integer_exponent = truncate(integer_exponent * power, working_precision, upper);
+					}
+					n >>= 1;
+					if(n == 0){
+						break;
+					}
+					power = truncate(power * power, working_precision, upper);
+				}
+				result = result * integer_exponent;
+			}
+
+			return truncate(result, max_error_exponent + 2, upper);
 		}
 
 		/**
-		 *  LOGARITHM(BASE e) FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates log(base e) of a exact_number using taylor expansion
+		 *  LOGARITHM(BASE e) FUNCTION BY ARGUMENT REDUCTION AND NEWTON'S METHOD ON EXPONENT
+		 * @brief: calculates log(base e) of a exact_number. x is reduced to m = x/2^j, close to 1, so
+		 * that ln x = j ln 2 + ln m, with the cached ln 2. ln m is the root y of e^y = m, found by
+		 * iterating y += 2 atanh(u) ~ 2u, with u = (m e^(-y) - 1)/(m e^(-y) + 1), the Newton
+		 * (Halley) step that triples the correct digits of y each time. The precision of the exponent
+		 * grows with the digits of y, so that the total work is a few evaluations of the exponent at
+		 * the full precision, instead of a series in x which needs more terms as x moves away from 1.
 		 * @param: x: the exact number. whose logarithm (ln(x)) is to be found
 		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
 		 * @param:  upper: if true: error lies in [0, +epsilon]
@@ -48,48 +508,233 @@ namespace boost{
 		template<typename T>
 		exact_number<T> logarithm(exact_number<T> x, size_t max_error_exponent, bool upper){
 			// log is only defined for numbers greater than 0
-			static const exact_number<T> two("2");
 			if(x == literals::zero_exact<T> || x.positive == false){
 				throw logarithm_not_defined_for_non_positive_number();
 			}
-			exact_number<T> result("0");
-			exact_number<T> term_number("1");
-			unsigned int term_number_int = 1;
-			exact_number<T> cur_term("0");
-			exact_number<T> x_pow ("1");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			
-			if(x > literals::zero_exact<T> && x < two){
-				do{
-					if(term_number_int %2 == 1)
-						result -= cur_term;
-					else 
-						result += cur_term;	
-					x_pow = x_pow * (x - literals::one_exact<T>);
-					cur_term = x_pow;
-					cur_term.divide_vector(term_number, max_error_exponent, upper);
-					++term_number_int;
-					term_number = term_number + literals::one_exact<T>;
-				}while(cur_term.abs() > max_error);
-				return result;
+			if(x == literals::one_exact<T>){
+				return literals::zero_exact<T>;
+			}
+			if(x == literals::two_exact<T>){
+				return constants<T>::ln_two().get(max_error_exponent, upper);
+			}
+			if(x == integer_exact<T>(10)){
+				return constants<T>::ln_ten().get(max_error_exponent, upper);
 			}
 
-			do{
-				result += cur_term;
-				x_pow = x_pow * (x - literals::one_exact<T>);
-				x_pow.divide_vector(x, max_error_exponent, upper);
-				cur_term = x_pow ;
-				cur_term.divide_vector(term_number, max_error_exponent, upper);
-				++term_number_int;
-				term_number = term_number + literals::one_exact<T>;
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
+			const size_t bits = digit_bits<T>();
+			const size_t precision = max_error_exponent + 3;
+
+			// x = 2^j * m, with m close to 1. As ln m has a derivative lower than 2 around 1, rounding m
+			// to the precision costs at most twice as much in ln m
+			long j = std::lround(log2_estimate(x));
+			exact_number<T> m = x;
+			exact_number<T> j_ln_two;
+			if(j != 0){
+				exact_number<T> power = exact_number<T>::binary_exponentiation(literals::two_exact<T>, integer_exact<T>(std::labs(j)));
+				if(j > 0){
+					m.divide_vector(power, precision, upper);
+				}
+				else{
+					m = m * power;
+				}
+				// j ln 2 grows with j, and bounding it in the direction of the result takes the
+				// opposite bound of ln 2 for negative j
+				size_t j_digits = (size_t)(std::log2((double)std::labs(j)) / bits) + 1;
+				j_ln_two = integer_exact<T>(j) * constants<T>::ln_two().get(precision + j_digits, (j > 0) ? upper : !upper);
+			}
+
+			// ln m = y + ln z = y + 2 atanh(u), with z = m e^(-y) and u = (z - 1)/(z + 1) = 1 - 2/(z + 1).
+			// |2 atanh(u) - 2u| <= |u|^3 for small u, so y + 2u is the next approximation of ln m, and
+			// y + 2u -/+ |u|^3 bounds ln m
+			exact_number<T> y;
+			exact_number<T> max_error(std::vector<T> {1}, -(long)precision + 1, true);
+			size_t working_precision = 2;
+			while(true){
+				// z, and so u, in the direction of the result
+				exact_number<T> z = m * exponent(literals::zero_exact<T> - y, working_precision, upper);
+				exact_number<T> w = literals::two_exact<T>;
+				w.divide_vector(z + literals::one_exact<T>, working_precision, !upper);
+				exact_number<T> u = truncate(literals::one_exact<T> - w, working_precision, upper);
+
+				exact_number<T> cubed = u.abs().up_to(2, true);
+				cubed = cubed * cubed * cubed;
+				if(working_precision == precision && cubed <= max_error){
+					exact_number<T> result = y + literals::two_exact<T> * u;
+					if(upper){
+						result += cubed;
+					}
+					else{
+						result -= cubed;
+					}
+					return truncate(result + j_ln_two, max_error_exponent + 2, upper);
+				}
+
+				// the error of y + 2u is about |u|^3, and the next step will make it about |u|^9
+				y = truncate(y + literals::two_exact<T> * u, working_precision, upper);
+				double correct_bits = (u == literals::zero_exact<T>) ? (double)(precision * bits) : -log2_estimate(u);
+				working_precision = std::min(precision, (size_t)(9 * std::max(correct_bits, 1.0) / bits) + 2);
+			}
+		}
+
+		/**
+		 *  SINE SERIES
+		 * @brief: calculates sin(x) of a exact_number using taylor expansion, summed by binary splitting.
+		 * The number of terms grows with |x|, see sine for arguments that are not small.
+		 * @param: x: the exact_number, representing angle in radian
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @author: Vikram Singh Chundawat
+		 **/
+		template<typename T>
+		exact_number<T> sine_series(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			if(x == literals::zero_exact<T>){
+				return literals::zero_exact<T>;
+			}
+			// the terms (-1)^n x^(2n+1) / (2n+1)!, each the previous one times -x^2 / ((2n)(2n+1))
+			exact_number<T> numerator, denominator;
+			std::tie(numerator, denominator) = as_fraction(x);
+			exact_number<T> minus_numerator_square = numerator * numerator;
+			minus_numerator_square.positive = false;
+			exact_number<T> denominator_square = denominator * denominator;
+
+			size_t terms = series_terms<T>(log2_estimate(x), max_error_exponent, 1, 2);
+			auto sum = binary_splitting<T>(0, terms,
+				[&](size_t k){ return (k == 0) ? numerator : minus_numerator_square; },
+				[&](size_t k){ return (k == 0) ? denominator : denominator_square * integer_exact<T>((2 * k) * (2 * k + 1)); },
+				[](size_t){ return literals::one_exact<T>; });
+			return series_sum(sum, max_error_exponent, upper);
+		}
+
+		/**
+		 *  COSINE SERIES
+		 * @brief: calculates cos(x) of a exact_number using taylor expansion, summed by binary splitting.
+		 * The number of terms grows with |x|, see cosine for arguments that are not small.
+		 * @param: x: the exact_number, representing angle in radian
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @author: Vikram Singh Chundawat
+		 **/
+		template<typename T>
+		exact_number<T> cosine_series(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			if(x == literals::zero_exact<T>){
+				return literals::one_exact<T>;
+			}
+			// the terms (-1)^n x^(2n) / (2n)!, each the previous one times -x^2 / ((2n-1)(2n))
+			exact_number<T> numerator, denominator;
+			std::tie(numerator, denominator) = as_fraction(x);
+			exact_number<T> minus_numerator_square = numerator * numerator;
+			minus_numerator_square.positive = false;
+			exact_number<T> denominator_square = denominator * denominator;
+
+			size_t terms = series_terms<T>(log2_estimate(x), max_error_exponent, 0, 2);
+			auto sum = binary_splitting<T>(0, std::max<size_t>(terms, 1),
+				[&](size_t k){ return (k == 0) ? literals::one_exact<T> : minus_numerator_square; },
+				[&](size_t k){ return (k == 0) ? literals::one_exact<T> : denominator_square * integer_exact<T>((2 * k - 1) * (2 * k)); },
+				[](size_t){ return literals::one_exact<T>; });
+			return series_sum(sum, max_error_exponent, upper);
+		}
+
+		/**
+		 * @brief: x = quotient * π/2 + r, with quotient the integer closest to x/(π/2), so that |r| is
+		 * about π/4 at most. The bounds of r come from the bounds of π.
+		 **/
+		template<typename T>
+		struct half_pi_reduction{
+			exact_number<T> quotient;
+			int quadrant; // quotient mod 4, in [0, 3]
+			exact_number<T> lower;
+			exact_number<T> upper;
+		};
+
+		/**
+		 * @brief: reduces x modulo π/2, see half_pi_reduction. π is taken with as many more digits as
+		 * the quotient has, so that the bounds of r are within base^(-max_error_exponent - 2) of it.
+		 * x = 0, or x small enough for the quotient to be 0, costs no π at all.
+		 * @param: x: the exact_number, representing angle in radian
+		 * @param: max_error_exponent: the precision of the bounds of r
+		 **/
+		template<typename T>
+		half_pi_reduction<T> reduce_half_pi(const exact_number<T>& x, size_t max_error_exponent){
+			static const T base = (std::numeric_limits<T>::max() / 4) * 2;
+			half_pi_reduction<T> reduction{literals::zero_exact<T>, 0, x, x};
+			if(x == literals::zero_exact<T>){
+				return reduction;
+			}
+
+			// the quotient of 2|x| by π, with π precise enough for the integer part to be right, but
+			// for rounding at its last digit
+			exact_number<T> magnitude = x.abs();
+			size_t integer_digits = (size_t)std::max(magnitude.exponent, 0);
+			exact_number<T> quotient = literals::two_exact<T> * magnitude;
+			quotient.divide_vector(constants<T>::pi().get(integer_digits + 2, false), integer_digits + 2, false);
+			quotient = integer_part(quotient + exact_number<T>(std::vector<T> {base / 2}, 0, true));
+			if(quotient == literals::zero_exact<T>){
+				return reduction;
+			}
+
+			int quadrant = 0;
+			for(int i = 0; i < quotient.exponent; ++i){
+				T digit = (i < (int)quotient.digits.size()) ? quotient.digits[i] : 0;
+				quadrant = (quadrant * (int)(base % 4) + (int)(digit % 4)) % 4;
+			}
+
+			// |x| - quotient * π/2, the error of π multiplied by the quotient
+			exact_number<T> half(std::vector<T> {base / 2}, 0, true);
+			size_t pi_precision = max_error_exponent + 3 + (size_t)std::max(quotient.exponent, 0);
+			exact_number<T> lower = magnitude - quotient * constants<T>::pi().get(pi_precision, true) * half;
+			exact_number<T> upper = magnitude - quotient * constants<T>::pi().get(pi_precision, false) * half;
+
+			if(x.positive){
+				return {quotient, quadrant, lower, upper};
+			}
+			// x = -quotient * π/2 - r
+			quotient.positive = false;
+			lower.positive = !lower.positive;
+			upper.positive = !upper.positive;
+			return {quotient, (4 - quadrant) % 4, upper, lower};
+		}
+
+		/**
+		 * @brief: sin(x + shift * π/2), with x reduced by reduce_half_pi. It is sin r, cos r, -sin r
+		 * or -cos r, depending on the quadrant, with |r| <= π/4, where sine is increasing and
+		 * cosine is decreasing in |r|, so that the bounds of r give the bounds of the result.
+		 * @param: reduction: x, reduced modulo π/2
+		 * @param: shift: 0 for sin(x), 1 for cos(x)
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> reduced_sine(const half_pi_reduction<T>& reduction, int shift, size_t max_error_exponent, bool upper){
+			int quadrant = (reduction.quadrant + shift) % 4;
+			bool negative = quadrant >= 2;
+			bool bound = negative ? !upper : upper;
+
+			exact_number<T> result;
+			if(quadrant % 2 == 0){
+				result = sine_series(bound ? reduction.upper : reduction.lower, max_error_exponent, bound);
+			}
+			else{
+				exact_number<T> lower_magnitude = reduction.lower.abs();
+				exact_number<T> upper_magnitude = reduction.upper.abs();
+				exact_number<T> farthest = std::max(lower_magnitude, upper_magnitude);
+				exact_number<T> closest = (reduction.lower.positive != reduction.upper.positive) ?
+				                          literals::zero_exact<T> : std::min(lower_magnitude, upper_magnitude);
+				result = cosine_series(bound ? closest : farthest, max_error_exponent, bound);
+			}
+
+			if(negative && result != literals::zero_exact<T>){
+				result.positive = !result.positive;
+			}
 			return result;
 		}
 
 		/**
-		 *  SINE FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates sin(x) of a exact_number using taylor expansion
+		 *  SINE FUNCTION
+		 * @brief: calculates sin(x) of a exact_number, reducing x modulo π/2 and summing the taylor
+		 * series of sine or cosine of the remainder, so that the number of terms does not grow with x.
 		 * @param: x: the exact_number, representing angle in radian
 		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
 		 * @param:  upper: if true: error lies in [0, +epsilon]
@@ -98,37 +743,12 @@ namespace boost{
 		 **/
 		template<typename T>
 		exact_number<T> sine(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("0");
-			exact_number<T> term_number("0");
-			unsigned int term_number_int = 0;
-			exact_number<T> cur_term(x);
-			exact_number<T> x_pow(x);
-			exact_number<T> factorial("1");
-			exact_number<T> tmp;
-			exact_number<T> x_square = x*x;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			static exact_number<T> two("2");
-			
-			do{
-				if(term_number_int % 2 == 0){ // if this term is even
-					result += cur_term;
-				}
-				else 
-					result -= cur_term; // if this term is odd
-				++term_number_int;
-				term_number = term_number + literals::one_exact<T>;
-				x_pow *= x_square; // increasing power by two powers of original x
-				factorial = factorial * ( two * term_number) * ( (two * term_number) + literals::one_exact<T>); // increasing the values of factorial by two
-				cur_term  = x_pow;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
-			return result;
+			return reduced_sine(reduce_half_pi(x, max_error_exponent), 0, max_error_exponent, upper);
 		}
 
 		/**
-		 *  COSINE FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates cos(x) of a exact_number using taylor expansion
+		 *  COSINE FUNCTION
+		 * @brief: calculates cos(x) of a exact_number, as sine does
 		 * @param: x: the exact_number, representing angle in radian
 		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
 		 * @param:  upper: if true: error lies in [0, +epsilon]
@@ -137,39 +757,12 @@ namespace boost{
 		 **/
 		template<typename T>
 		exact_number<T> cosine(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("1");
-			exact_number<T> cur_term("0");
-			exact_number<T> square_x = x*x;
-			exact_number<T> cur_power("1");
-			exact_number<T> factorial("1");
-			static exact_number<T> two("2");
-			exact_number<T> term_number("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			int term_number_int = 0;
-			do{
-				if(term_number_int % 2 == 0)
-					result += cur_term;
-				else 
-					result -= cur_term;
-				
-				for(exact_number<T> i = (two * term_number) + literals::one_exact<T> ; i <= two * (term_number + literals::one_exact<T>); i = i + literals::one_exact<T>){
-					factorial *= i;
-				}
-				cur_power *= square_x;
-				cur_term = cur_power;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
-				++ term_number_int;
-				term_number = term_number + literals::one_exact<T>;
-				
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
-			return result;
+			return reduced_sine(reduce_half_pi(x, max_error_exponent), 1, max_error_exponent, upper);
 		}
 
-		 
-		 /**
-		 *  SINE AND COSINE FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates cos(x) and sin(x) of a exact_number using taylor expansion
+		/**
+		 *  SINE AND COSINE FUNCTION
+		 * @brief: calculates cos(x) and sin(x) of a exact_number, reducing x once for both
 		 * @param: x: the exact_number, representing angle in radian
 		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
 		 * @param:  upper: if true: error lies in [0, +epsilon]
@@ -179,43 +772,51 @@ namespace boost{
 		 **/
 		template<typename T>
 		std::tuple<exact_number<T>, exact_number<T> > sin_cos(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> sin_result("0");
-			exact_number<T> cos_result("0");
-			exact_number<T> cur_sin_term = x;
-			exact_number<T> cur_cos_term("1");
-			exact_number<T> cur_power = x;
-			exact_number<T> factorial("1");
-			static exact_number<T> two("2");
-			exact_number<T> factorial_number("1");
-			unsigned int term_number_int = 0;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			do{
-
-				if(term_number_int % 2 == 0){
-					sin_result += cur_sin_term;
-					cos_result += cur_cos_term;
-				}
-				else{
-					sin_result -= cur_sin_term;
-					cos_result -= cur_cos_term;
-				}
-				++term_number_int;
-				factorial_number = factorial_number + literals::one_exact<T>;
-				factorial *= factorial_number;
-				cur_power *= x;
-				cur_cos_term = cur_power;
-				cur_cos_term.divide_vector(factorial, max_error_exponent, upper);
-
-				factorial_number = factorial_number + literals::one_exact<T>;
-				factorial *= factorial_number;
-				cur_power *= x;
-				cur_sin_term = cur_power;
-				cur_sin_term.divide_vector(factorial, max_error_exponent, upper);
-			}while( (cur_cos_term.abs() > max_error) || (cur_sin_term.abs() > max_error) );
-
-			return std::make_tuple(sin_result, cos_result);
+			half_pi_reduction<T> reduction = reduce_half_pi(x, max_error_exponent);
+			return std::make_tuple(reduced_sine(reduction, 0, max_error_exponent, upper),
+			                       reduced_sine(reduction, 1, max_error_exponent, upper));
 		}
 
+		/**
+		 * @brief: sin and cos of the bounds of an interval, kept by the node that needs them, so that
+		 * sin_cos is called once per bound and precision. When a bound stops changing from one
+		 * iteration to the next, as it does once all the digits of an operand are known, the pair is
+		 * computed ahead at twice the precision, and the next iterations only truncate it.
+		 **/
+		template<typename T>
+		class sin_cos_cache{
+			private:
+				struct entry{
+					exact_number<T> x;
+					size_t max_error_exponent = 0;
+					exact_number<T> sin, cos;
+				};
+				entry _entries[2]; // of the lower and of the upper bound
+
+			public:
+				/**
+				 * @brief: sin(x) and cos(x), as sin_cos, with x the lower or the upper bound
+				 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+				 * @param:  upper: if true: the upper bound, with the error in [0, +epsilon]
+				 *                  else: the lower bound, with the error in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+				 **/
+				std::tuple<exact_number<T>, exact_number<T> > get(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+					entry& kept = _entries[upper];
+					bool same_bound = kept.max_error_exponent != 0 && kept.x == x;
+					if(!same_bound || kept.max_error_exponent <= max_error_exponent){
+						size_t precision = same_bound ? 2 * max_error_exponent + 2 : max_error_exponent;
+						std::tie(kept.sin, kept.cos) = sin_cos(x, precision, upper);
+						kept.x = x;
+						kept.max_error_exponent = precision;
+						if(!same_bound){
+							return std::make_tuple(kept.sin, kept.cos);
+						}
+					}
+					return std::make_tuple(truncate(kept.sin, max_error_exponent + 1, upper),
+					                       truncate(kept.cos, max_error_exponent + 1, upper));
+				}
+		};
+
 		/**
 		 *  TANGENT FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates tan(x) of a exact_number using taylor expansion
@@ -286,7 +887,276 @@ namespace boost{
 			return result;
 		}
 
+		/**
+		 *  ARCTANGENT SERIES
+		 * @brief: calculates atan(x) of a small exact_number using taylor expansion, summed by binary
+		 * splitting. The number of terms grows as |x| gets closer to 1, see arctangent.
+		 * @param: x: the exact_number, with |x| about 1/2 at most
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> arctangent_series(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			static const double log2_base = std::log2((double)((std::numeric_limits<T>::max() / 4) * 2));
+			if(x == literals::zero_exact<T>){
+				return literals::zero_exact<T>;
+			}
+			// the terms (-1)^k x^(2k+1) / (2k+1), each the previous one times -x^2 (2k-1)/(2k+1). They
+			// alternate in sign and decrease, so the terms left out sum less than the first of them
+			exact_number<T> numerator, denominator;
+			std::tie(numerator, denominator) = as_fraction(x);
+			exact_number<T> minus_numerator_square = numerator * numerator;
+			minus_numerator_square.positive = false;
+			exact_number<T> denominator_square = denominator * denominator;
+
+			size_t terms = (size_t)(((double)max_error_exponent + 2) * log2_base / (-2 * log2_estimate(x))) + 1;
+			auto sum = binary_splitting<T>(0, terms,
+				[&](size_t k){ return (k == 0) ? numerator : minus_numerator_square * integer_exact<T>(2 * (long long)k - 1); },
+				[&](size_t k){ return (k == 0) ? denominator : denominator_square * integer_exact<T>(2 * (long long)k + 1); },
+				[](size_t){ return literals::one_exact<T>; });
+			return series_sum(sum, max_error_exponent, upper);
+		}
+
+		/**
+		 *  ARCTANGENT FUNCTION WITH ARGUMENT REDUCTION
+		 * @brief: calculates atan(x) of a exact_number. x is brought to |x| <= 1/2 by
+		 * atan(x) = π/2 - atan(1/x) and atan(x) = π/4 + atan((x - 1)/(x + 1)), and is then split as
+		 * h + r, with h the first digits of x, so that atan(x) = atan(h) + atan((x - h)/(1 + x h)).
+		 * atan(h) is summed by binary splitting, on the few digits of h, and the remainder, lower
+		 * than the last digit of h, is split again with twice as many digits, so that each series
+		 * either has small integers or needs few terms.
+		 * The steps are computed two digits beyond the precision, and as the derivative of atan is at
+		 * most 1, their errors add up to the error of the result, which is added in the direction of
+		 * the bound.
+		 * @param: x: the exact_number whose arctangent is to be found
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> arctangent(exact_number<T> x, size_t max_error_exponent, bool upper){
+			if(x == literals::zero_exact<T>){
+				return literals::zero_exact<T>;
+			}
+			if(!x.positive){
+				// atan is odd, and a bound of atan(-x) gives the opposite bound of atan(x)
+				x.positive = true;
+				exact_number<T> result = arctangent(x, max_error_exponent, !upper);
+				if(result != literals::zero_exact<T>){
+					result.positive = !result.positive;
+				}
+				return result;
+			}
+
+			static const exact_number<T> half(std::vector<T> {std::numeric_limits<T>::max() / 4}, 0, true);
+			const size_t precision = max_error_exponent + 2;
+			// the errors of the steps, each lower than base^(-precision)
+			int errors = 0;
+
+			// atan(x) = quarters * π/4 +/- atan(x'), with |x'| <= 1/2
+			int quarters = 0;
+			bool negate = false;
+			if(x > literals::one_exact<T>){
+				exact_number<T> reciprocal = literals::one_exact<T>;
+				reciprocal.divide_vector(x, precision, false);
+				x = reciprocal;
+				quarters = 2;
+				negate = true;
+				++errors;
+			}
+			if(x > half){
+				exact_number<T> reduced = x - literals::one_exact<T>;
+				reduced.divide_vector(x + literals::one_exact<T>, precision, false);
+				x = reduced;
+				quarters += negate ? -1 : 1;
+				++errors;
+			}
+
+			// the last step takes the digits of x down to base^(-precision), and leaves out an
+			// arctangent lower than base^(-precision)
+			exact_number<T> sum;
+			for(size_t digits = 1; x != literals::zero_exact<T>; digits *= 2){
+				bool last = digits >= precision;
+				size_t head_digits = last ? precision : digits;
+				if((long)x.exponent + (long)head_digits <= 0){
+					// x is lower than the last digit of h
+					if(last){
+						++errors;
+						break;
+					}
+					continue;
+				}
+
+				exact_number<T> head = truncate(x, head_digits, false);
+				sum = sum + arctangent_series(head, precision, false);
+				++errors;
+				if(last){
+					++errors;
+					break;
+				}
+
+				exact_number<T> rest = x - head;
+				if(rest == literals::zero_exact<T>){
+					break;
+				}
+				rest.divide_vector(literals::one_exact<T> + x * head, precision, false);
+				x = rest;
+				++errors;
+			}
+
+			exact_number<T> result = sum;
+			if(negate && result != literals::zero_exact<T>){
+				result.positive = !result.positive;
+			}
+			if(quarters != 0){
+				// quarters * π/4, within quarters/4 of base^(-precision)
+				result = result + integer_exact<T>(quarters) * constants<T>::pi().get(precision, false) * half * half;
+				++errors;
+			}
+
+			exact_number<T> error(std::vector<T> {(T)errors}, 1 - (int)precision, true);
+			if(upper){
+				result += error;
+			}
+			else{
+				result -= error;
+			}
+			return truncate(result, precision, upper);
+		}
+
+		/**
+		 *  ARCSINE FUNCTION
+		 * @brief: calculates asin(x) of a exact_number in [-1, 1], as 2 atan(x / (1 + sqrt(1 - x^2))).
+		 * Unlike atan(x / sqrt(1 - x^2)), the argument of atan stays in [-1, 1] and moves by at most
+		 * the error of the square root, even for x close to 1 or -1.
+		 * @param: x: the exact_number whose arcsine is to be found
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @throws: boost::real::arcsine_not_defined_outside_unit_interval if |x| > 1
+		 **/
+		template<typename T>
+		exact_number<T> arcsine(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			if(x.abs() > literals::one_exact<T>){
+				throw arcsine_not_defined_outside_unit_interval();
+			}
+			if(x == literals::zero_exact<T>){
+				return literals::zero_exact<T>;
+			}
+
+			// the square root and the division are each within base^(-precision), so the argument of
+			// atan is within twice that, and so is atan, whose derivative is at most 1
+			const size_t precision = max_error_exponent + 2;
+			exact_number<T> root = square_root(literals::one_exact<T> - x * x, precision, false);
+			exact_number<T> argument = x;
+			argument.divide_vector(literals::one_exact<T> + root, precision, false);
+
+			exact_number<T> result = literals::two_exact<T> * arctangent(argument, precision, upper);
+			exact_number<T> error(std::vector<T> {4}, 1 - (int)precision, true);
+			if(upper){
+				result += error;
+			}
+			else{
+				result -= error;
+			}
+			return truncate(result, precision, upper);
+		}
+
+		/**
+		 *  ARCCOSINE FUNCTION
+		 * @brief: calculates acos(x) of a exact_number in [-1, 1], as π/2 - asin(x)
+		 * @param: x: the exact_number whose arccosine is to be found
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @throws: boost::real::arcsine_not_defined_outside_unit_interval if |x| > 1
+		 **/
+		template<typename T>
+		exact_number<T> arccosine(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			if(x == literals::one_exact<T>){
+				return literals::zero_exact<T>;
+			}
+			static const exact_number<T> half(std::vector<T> {std::numeric_limits<T>::max() / 4}, 0, true);
+			exact_number<T> half_pi = constants<T>::pi().get(max_error_exponent + 2, upper) * half;
+			return truncate(half_pi - arcsine(x, max_error_exponent + 2, !upper), max_error_exponent + 2, upper);
+		}
+
+		/**
+		 *  HYPERBOLIC SINE AND COSINE FUNCTION
+		 * @brief: calculates sinh(x) = (e^x - e^(-x))/2 and cosh(x) = (e^x + e^(-x))/2 of a
+		 * exact_number from a single exponent: e^|x| is computed, and e^(-|x|) is its reciprocal.
+		 * @param: x: the exact_number whose hyperbolic sine and cosine are to be found
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @return: a tuple containing sinh(x) and cosh(x)
+		 **/
+		template<typename T>
+		std::tuple<exact_number<T>, exact_number<T> > sinh_cosh(const exact_number<T>& x, size_t max_error_exponent, bool upper){
+			if(x == literals::zero_exact<T>){
+				return std::make_tuple(literals::zero_exact<T>, literals::one_exact<T>);
+			}
+			static const exact_number<T> half(std::vector<T> {std::numeric_limits<T>::max() / 4}, 0, true);
+			const size_t precision = max_error_exponent + 2;
+
+			// e^|x| >= 1 is within base^(-precision), and so is its reciprocal, but for the division
+			// which adds as much again, so the half sum and the half difference are within twice that
+			exact_number<T> growing = exponent(x.abs(), precision, false);
+			exact_number<T> decaying = literals::one_exact<T>;
+			decaying.divide_vector(growing, precision, false);
+
+			exact_number<T> sinh = (growing - decaying) * half;
+			exact_number<T> cosh = (growing + decaying) * half;
+			if(!x.positive && sinh != literals::zero_exact<T>){
+				sinh.positive = false;
+			}
+
+			exact_number<T> error(std::vector<T> {2}, 1 - (int)precision, true);
+			if(upper){
+				sinh += error;
+				cosh += error;
+			}
+			else{
+				sinh -= error;
+				cosh -= error;
+			}
+			return std::make_tuple(truncate(sinh, precision, upper), truncate(cosh, precision, upper));
+		}
+
+		/**
+		 *  HYPERBOLIC TANGENT FUNCTION
+		 * @brief: calculates tanh(x) of a exact_number, as (1 - u)/(1 + u) with u = e^(-2x) in (0, 1]
+		 * for x > 0, from a single exponent. tanh is odd.
+		 * @param: x: the exact_number whose hyperbolic tangent is to be found
+		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 **/
+		template<typename T>
+		exact_number<T> hyperbolic_tangent(exact_number<T> x, size_t max_error_exponent, bool upper){
+			if(x == literals::zero_exact<T>){
+				return literals::zero_exact<T>;
+			}
+			if(!x.positive){
+				x.positive = true;
+				exact_number<T> result = hyperbolic_tangent(x, max_error_exponent, !upper);
+				if(result != literals::zero_exact<T>){
+					result.positive = !result.positive;
+				}
+				return result;
+			}
+
+			// (1 - u)/(1 + u) decreases with u, at most twice as fast, so the opposite bound of u gives
+			// the bound of the result, within three times base^(-precision) with the division
+			const size_t precision = max_error_exponent + 2;
+			exact_number<T> u = exponent(literals::zero_exact<T> - literals::two_exact<T> * x, precision, !upper);
+			exact_number<T> result = literals::one_exact<T> - u;
+			result.divide_vector(literals::one_exact<T> + u, precision, upper);
+			return truncate(result, precision, upper);
+		}
+
 	}
 }
 
-#endif//BOOST_REAL_MATH_HPP
\ No newline at end of file
+#endif//BOOST_REAL_MATH_
\ No newline at end of file
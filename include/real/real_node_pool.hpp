@@ -0,0 +1,175 @@
+#ifndef BOOST_REAL_REAL_NODE_POOL_HPP
+#define BOOST_REAL_REAL_NODE_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        // fwd decl needed
+        template <typename T>
+        class real_data;
+
+        namespace detail {
+
+            /**
+             * @brief a free list of memory blocks of a single size, one per thread.
+             *
+             * @details blocks are carved from chunks of blocks_per_chunk blocks and are never given back
+             * to the system, a freed block goes to the free list of the thread that frees it. When a
+             * thread exits, its free list is moved to a shared list of orphan blocks, that the pools of
+             * the other threads adopt when they run out of blocks.
+             */
+            template <size_t size, size_t alignment>
+            class block_pool {
+            private:
+                struct free_block {
+                    free_block* next;
+                };
+
+                static constexpr size_t block_size =
+                    ((std::max(size, sizeof(free_block)) + alignment - 1) / alignment) * alignment;
+                static constexpr size_t blocks_per_chunk = 256;
+
+                free_block* _free = nullptr;
+
+                inline static std::mutex _orphans_mutex;
+                inline static free_block* _orphans = nullptr;
+
+                // the thread local pool is destroyed before the thread's last nodes may be freed
+                // (e.g. by the destructors of static reals), those blocks go straight to the orphans
+                inline static thread_local bool _destroyed = false;
+
+                static void push_orphans(free_block* first, free_block* last) {
+                    std::lock_guard<std::mutex> lock(_orphans_mutex);
+                    last->next = _orphans;
+                    _orphans = first;
+                }
+
+                void refill() {
+                    {
+                        std::lock_guard<std::mutex> lock(_orphans_mutex);
+                        if (_orphans != nullptr) {
+                            _free = _orphans;
+                            _orphans = nullptr;
+                            return;
+                        }
+                    }
+
+                    char* chunk = static_cast<char*>(::operator new(block_size * blocks_per_chunk,
+                                                                    std::align_val_t(alignment)));
+                    for (size_t i = 0; i < blocks_per_chunk; i++) {
+                        auto block = reinterpret_cast<free_block*>(chunk + i * block_size);
+                        block->next = _free;
+                        _free = block;
+                    }
+                }
+
+                ~block_pool() {
+                    _destroyed = true;
+                    if (_free != nullptr) {
+                        free_block* last = _free;
+                        while (last->next != nullptr) {
+                            last = last->next;
+                        }
+                        push_orphans(_free, last);
+                    }
+                }
+
+                static block_pool& local() {
+                    thread_local block_pool pool;
+                    return pool;
+                }
+
+            public:
+                static void* allocate() {
+                    if (_destroyed) {
+                        return ::operator new(block_size, std::align_val_t(alignment));
+                    }
+
+                    block_pool& pool = local();
+                    if (pool._free == nullptr) {
+                        pool.refill();
+                    }
+                    free_block* block = pool._free;
+                    pool._free = block->next;
+                    return block;
+                }
+
+                static void deallocate(void* p) {
+                    auto block = static_cast<free_block*>(p);
+                    if (_destroyed) {
+                        push_orphans(block, block);
+                        return;
+                    }
+
+                    block_pool& pool = local();
+                    block->next = pool._free;
+                    pool._free = block;
+                }
+            };
+        }
+
+        /**
+         * @brief boost::real::pool_allocator is a stateless allocator that takes single objects from
+         * thread local free lists of same sized blocks, instead of calling the global operator new.
+         *
+         * @details it is meant for the nodes of the operation trees, which are all allocated through
+         * std::allocate_shared, so the allocated type is the shared_ptr control block holding the node.
+         * Requests for more than one object are forwarded to std::allocator.
+         */
+        template <typename U>
+        class pool_allocator {
+        public:
+            using value_type = U;
+
+            pool_allocator() noexcept = default;
+
+            template <typename V>
+            pool_allocator(const pool_allocator<V>&) noexcept {};
+
+            U* allocate(size_t n) {
+                if (n != 1) {
+                    return std::allocator<U>().allocate(n);
+                }
+                return static_cast<U*>(detail::block_pool<sizeof(U), alignof(U)>::allocate());
+            }
+
+            void deallocate(U* p, size_t n) {
+                if (n != 1) {
+                    std::allocator<U>().deallocate(p, n);
+                    return;
+                }
+                detail::block_pool<sizeof(U), alignof(U)>::deallocate(p);
+            }
+
+            template <typename V>
+            bool operator==(const pool_allocator<V>&) const noexcept {
+                return true;
+            }
+
+            template <typename V>
+            bool operator!=(const pool_allocator<V>&) const noexcept {
+                return false;
+            }
+        };
+
+        /**
+         * @brief creates a new real_data from x, in memory taken from the node pool.
+         *
+         * @param x - the explicit, algorithmic, operation or rational number the node represents.
+         * @return a shared_ptr to the new node.
+         */
+        template <typename T, typename X>
+        std::shared_ptr<real_data<T>> make_real_data(const X& x) {
+            return std::allocate_shared<real_data<T>>(pool_allocator<real_data<T>>(), x);
+        }
+    }
+}
+
+#endif // BOOST_REAL_REAL_NODE_POOL_HPP
@@ -0,0 +1,145 @@
+#ifndef BOOST_REAL_REAL_NODE_TABLE_HPP
+#define BOOST_REAL_REAL_NODE_TABLE_HPP
+
+#include <memory> // shared_ptr, weak_ptr
+#include <unordered_map>
+#include <vector>
+#include <tuple>
+#include <functional>
+
+#include <real/real_explicit.hpp>
+#include <real/real_operation.hpp>
+#include <real/real_data.hpp>
+#include <real/real_node_pool.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief boost::real::real_node_table is the (optional) hash-consing table of the expression DAG.
+         * When enabled, every real_operation is looked up by its operation and the identity of its
+         * operands, and every explicit leaf by its value, before a new real_data is created. Structurally
+         * identical nodes are therefore shared and, since each real_data holds its own precision iterator,
+         * a shared subexpression is evaluated once per precision level instead of once per copy.
+         *
+         * @details the table only holds weak references, so it never extends the life of a node. Entries
+         * whose node has died are dropped lazily. As shared nodes share their precision iterator, setting
+         * the maximum precision of a number also affects the numbers that were deduplicated with it.
+         *
+         * @note hash-consing is disabled by default, set real_node_table<T>::enabled to true to turn it on.
+         */
+        template <typename T = int>
+        class real_node_table {
+        private:
+            using operation_key = std::tuple<OPERATION, const real_data<T>*, const real_data<T>*>;
+            using explicit_key = std::tuple<std::vector<T>, int, bool>;
+
+            struct operation_key_hash {
+                size_t operator()(const operation_key& key) const {
+                    size_t seed = std::hash<int>()(static_cast<int>(std::get<0>(key)));
+                    seed ^= std::hash<const void*>()(std::get<1>(key)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                    seed ^= std::hash<const void*>()(std::get<2>(key)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                    return seed;
+                }
+            };
+
+            struct explicit_key_hash {
+                size_t operator()(const explicit_key& key) const {
+                    size_t seed = std::hash<int>()(std::get<1>(key)) ^ std::hash<bool>()(std::get<2>(key));
+                    for (const auto& d : std::get<0>(key)) {
+                        seed ^= std::hash<T>()(d) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                    }
+                    return seed;
+                }
+            };
+
+            inline static std::unordered_map<operation_key, std::weak_ptr<real_data<T>>, operation_key_hash> _operations;
+            inline static std::unordered_map<explicit_key, std::weak_ptr<real_data<T>>, explicit_key_hash> _explicits;
+
+            // number of entries at which expired entries are swept
+            inline static size_t _next_sweep = 64;
+
+            template <typename M>
+            static void sweep(M& nodes) {
+                for (auto it = nodes.begin(); it != nodes.end();) {
+                    if (it->second.expired()) {
+                        it = nodes.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+
+            static void sweep_if_needed() {
+                if (_operations.size() + _explicits.size() >= _next_sweep) {
+                    sweep(_operations);
+                    sweep(_explicits);
+                    _next_sweep = 2 * (_operations.size() + _explicits.size()) + 64;
+                }
+            }
+
+            template <typename M, typename K, typename X>
+            static std::shared_ptr<real_data<T>> intern(M& nodes, const K& key, const X& x) {
+                auto it = nodes.find(key);
+                if (it != nodes.end()) {
+                    // a live entry keeps its operands alive, so their addresses can't have been reused
+                    if (auto node = it->second.lock()) {
+                        return node;
+                    }
+                }
+
+                sweep_if_needed();
+                auto node = make_real_data<T>(x);
+                nodes[key] = node;
+                return node;
+            }
+
+        public:
+            /// hash-consing switch, when false the table is bypassed and every node is a new real_data
+            inline static bool enabled = false;
+
+            /**
+             * @brief returns the real_data representing the operation ro, sharing an existing node
+             * with the same operation and operands if there is one.
+             *
+             * @param ro - the operation to represent
+             * @return a shared_ptr to the (possibly shared) node
+             */
+            static std::shared_ptr<real_data<T>> make_operation(const real_operation<T>& ro) {
+                if (!enabled) {
+                    return make_real_data<T>(ro);
+                }
+                return intern(_operations, operation_key(ro.get_operation(), ro.lhs().get(), ro.rhs().get()), ro);
+            }
+
+            /**
+             * @brief returns the real_data representing the explicit number x, sharing an existing leaf
+             * with the same value if there is one.
+             *
+             * @param x - the explicit number to represent
+             * @return a shared_ptr to the (possibly shared) leaf
+             */
+            static std::shared_ptr<real_data<T>> make_explicit(const real_explicit<T>& x) {
+                if (!enabled) {
+                    return make_real_data<T>(x);
+                }
+                exact_number<T> number = x.get_exact_number();
+                return intern(_explicits, explicit_key(number.digits, number.exponent, number.positive), x);
+            }
+
+            /// number of entries in the table, including the ones not yet swept
+            static size_t size() {
+                return _operations.size() + _explicits.size();
+            }
+
+            /// forgets every entry, existing nodes stay valid but are no longer shared with new ones
+            static void clear() {
+                _operations.clear();
+                _explicits.clear();
+                _next_sweep = 64;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_NODE_TABLE_HPP
@@ -3,6 +3,7 @@
 
 #include <memory> // shared_ptr
 
+#include <real/interval.hpp>
 #include <real/real_algorithm.hpp>
 #include <real/real_explicit.hpp>
 
@@ -21,7 +22,7 @@ namespace boost{
         * 
         * @warning due to the recursive nature of real_operation, destruction may cause stack overflow
         */
-        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, INTEGER_POWER, EXPONENT, LOGARITHM, SIN, COS, TAN, COT, SEC, COSEC}; 
+        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, INTEGER_POWER, EXPONENT, LOGARITHM, SIN, COS, TAN, COT, SEC, COSEC, SQRT, NTH_ROOT, ATAN, ASIN, ACOS, SINH, COSH, TANH}; 
 
         template <typename T = int>
         class real_operation{
@@ -44,12 +45,29 @@ namespace boost{
                 return _operation;
             }
 
-            /// fwd decl'd, defined in real_data
+            /// fwd decl'd, defined in real_data. The operand is not locked, see with_lhs_itr
             const_precision_iterator<T>& get_lhs_itr();
             
-            /// fwd decl'd, defined in real_data
+            /// fwd decl'd, defined in real_data. The operand is not locked, see with_rhs_itr
             const_precision_iterator<T>& get_rhs_itr();
 
+            /// fwd decl'd, defined in real_data. Runs f on the left operand's iterator, with the operand locked
+            template <typename F>
+            decltype(auto) with_lhs_itr(F&& f);
+
+            /// fwd decl'd, defined in real_data. Runs f on the right operand's iterator, with the operand locked
+            template <typename F>
+            decltype(auto) with_rhs_itr(F&& f);
+
+            /// fwd decl'd, defined in real_data. A copy of the left operand's approximation interval
+            interval<T> lhs_interval();
+
+            /// fwd decl'd, defined in real_data. A copy of the right operand's approximation interval
+            interval<T> rhs_interval();
+
+            /// fwd decl'd, defined in real_data. Iterates the left operand n times
+            void iterate_lhs(int n);
+
             std::shared_ptr<real_data<T>> rhs() const {
                 return _rhs;
             }
@@ -0,0 +1,247 @@
+#ifndef BOOST_REAL_REAL_SORT_HPP
+#define BOOST_REAL_REAL_SORT_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <real/real.hpp>
+
+namespace boost {
+    namespace real {
+        namespace detail {
+
+            template <typename N>
+            struct real_value_type;
+
+            template <typename T>
+            struct real_value_type<real<T>> {
+                using type = T;
+            };
+
+            /**
+             * @brief an element to order: a distinct number of the range, the positions where it is,
+             * and its node, whose precision iterator keeps the highest precision reached so far.
+             */
+            template <typename T>
+            struct sort_entry {
+                std::vector<size_t> positions;
+                std::shared_ptr<real_data<T>> node;
+                interval<T> approximation;
+                size_t maximum_steps = 0;
+
+                bool refine() {
+                    return node->with_precision_itr([this](const_precision_iterator<T>& it) {
+                        if (approximation.is_a_number() || it.get_precision() > maximum_steps) {
+                            return false;
+                        }
+                        size_t steps = evaluation_context::refinement_steps(it.get_precision(), maximum_steps);
+                        if (steps == 1) {
+                            ++it;
+                        } else {
+                            it.iterate_n_times(steps);
+                        }
+                        approximation = it.get_interval();
+                        return true;
+                    });
+                }
+            };
+
+            /**
+             * @brief orders the entries of a range of real numbers by their current approximation and
+             * refines, level by level, only the entries whose intervals overlap.
+             */
+            template <typename T>
+            class adaptive_order {
+            private:
+                std::vector<sort_entry<T>> _entries;
+
+                /*
+                 * Sorts [first, last) by lower bound and splits it into clusters of overlapping intervals.
+                 * The numbers of a cluster are all lower than the numbers of the next one. Returns the
+                 * position where each cluster starts, followed by last.
+                 */
+                std::vector<size_t> clusters(size_t first, size_t last) {
+                    std::stable_sort(_entries.begin() + first, _entries.begin() + last,
+                        [](const sort_entry<T>& a, const sort_entry<T>& b) {
+                            return a.approximation.lower_bound < b.approximation.lower_bound;
+                        });
+
+                    std::vector<size_t> starts = {first};
+                    exact_number<T> upper = _entries[first].approximation.upper_bound;
+                    for (size_t i = first + 1; i < last; i++) {
+                        if (upper < _entries[i].approximation.lower_bound) {
+                            starts.push_back(i);
+                            upper = _entries[i].approximation.upper_bound;
+                        } else if (upper < _entries[i].approximation.upper_bound) {
+                            upper = _entries[i].approximation.upper_bound;
+                        }
+                    }
+                    starts.push_back(last);
+                    return starts;
+                }
+
+                /*
+                 * Refines the entries of the cluster [first, last). Returns false if the cluster is only
+                 * made of equal numbers, i.e. all of them are the same single number.
+                 */
+                bool refine(size_t first, size_t last) {
+                    bool refined = false;
+                    bool all_numbers = true;
+                    for (size_t i = first; i < last; i++) {
+                        refined = _entries[i].refine() || refined;
+                        all_numbers = all_numbers && _entries[i].approximation.is_a_number();
+                    }
+
+                    if (!refined && !all_numbers) {
+                        throw boost::real::precision_exception();
+                    }
+                    return refined;
+                }
+
+            public:
+                template <typename RandomIt>
+                adaptive_order(RandomIt first, RandomIt last) {
+                    // equal nodes share an entry, so they are never compared against each other
+                    std::unordered_map<const real_data<T>*, size_t> entry_of;
+
+                    for (RandomIt it = first; it != last; ++it) {
+                        const real_data<T>* node = it->_real_p.get();
+                        auto found = entry_of.find(node);
+                        size_t position = std::distance(first, it);
+
+                        if (found != entry_of.end()) {
+                            _entries[found->second].positions.push_back(position);
+                            continue;
+                        }
+
+                        entry_of[node] = _entries.size();
+                        sort_entry<T> entry;
+                        entry.positions.push_back(position);
+                        entry.node = it->_real_p;
+                        entry.approximation = it->refined_itr().get_interval();
+                        entry.maximum_steps = it->maximum_precision();
+                        _entries.push_back(std::move(entry));
+                    }
+                }
+
+                /// fully orders the entries
+                void sort() {
+                    if (_entries.empty()) {
+                        return;
+                    }
+
+                    std::vector<std::pair<size_t, size_t>> pending = {{0, _entries.size()}};
+                    while (!pending.empty()) {
+                        auto [first, last] = pending.back();
+                        pending.pop_back();
+
+                        std::vector<size_t> starts = clusters(first, last);
+                        for (size_t c = 0; c + 1 < starts.size(); c++) {
+                            if (starts[c + 1] - starts[c] > 1 && refine(starts[c], starts[c + 1])) {
+                                pending.emplace_back(starts[c], starts[c + 1]);
+                            }
+                        }
+                    }
+                }
+
+                /// orders the entries just enough to know which one is at the nth position of the range
+                void nth_element(size_t nth) {
+                    size_t first = 0;
+                    size_t last = _entries.size();
+                    size_t offset = 0; // number of elements of the range in the entries before first
+
+                    while (last - first > 1) {
+                        std::vector<size_t> starts = clusters(first, last);
+
+                        // only the cluster holding the nth position needs to be refined
+                        size_t c = 0;
+                        while (true) {
+                            size_t count = 0;
+                            for (size_t i = starts[c]; i < starts[c + 1]; i++) {
+                                count += _entries[i].positions.size();
+                            }
+                            if (offset + count > nth) {
+                                break;
+                            }
+                            offset += count;
+                            c++;
+                        }
+
+                        first = starts[c];
+                        last = starts[c + 1];
+                        if (last - first <= 1 || !refine(first, last)) {
+                            break;
+                        }
+                    }
+                }
+
+                /// moves the numbers of [first, last) to their place in the order of the entries
+                template <typename RandomIt>
+                void apply(RandomIt first, RandomIt last) {
+                    using number = typename std::iterator_traits<RandomIt>::value_type;
+                    std::vector<number> ordered;
+                    ordered.reserve(std::distance(first, last));
+
+                    for (const auto& entry : _entries) {
+                        for (size_t position : entry.positions) {
+                            ordered.push_back(first[position]);
+                        }
+                    }
+                    std::copy(ordered.begin(), ordered.end(), first);
+                }
+            };
+        }
+
+        /**
+         * @brief Sorts the range [first, last) of boost::real::real numbers in ascending order.
+         *
+         * @details The numbers are first ordered by their least precise approximation interval and
+         * split into clusters of overlapping intervals. Only the numbers of the clusters with more than
+         * one number are refined, one precision step at a time, and the clusters are split again until
+         * every number is separated from the others. Each number is refined in place by the precision
+         * iterator of its node, as in real::compare, so no number is evaluated twice at the same
+         * precision, even across several sorts of the same numbers.
+         * Copies of the same number (sharing their node) are kept together in their original order.
+         *
+         * @throws boost::real::precision_exception if two numbers can't be separated before reaching
+         * their maximum precision, as operator< would.
+         */
+        template <typename RandomIt>
+        void sort(RandomIt first, RandomIt last) {
+            using T = typename detail::real_value_type<typename std::iterator_traits<RandomIt>::value_type>::type;
+
+            detail::adaptive_order<T> order(first, last);
+            order.sort();
+            order.apply(first, last);
+        }
+
+        /**
+         * @brief Rearranges the range [first, last) of boost::real::real numbers so that the number at
+         * nth is the one that would be there if the range was sorted, the numbers before it are not
+         * greater and the numbers after it are not lower, as std::nth_element.
+         *
+         * @details As in boost::real::sort, the numbers are split into clusters of overlapping
+         * intervals, but only the cluster holding the nth position is refined.
+         *
+         * @throws boost::real::precision_exception if the nth number can't be separated from another
+         * one before reaching their maximum precision.
+         */
+        template <typename RandomIt>
+        void nth_element(RandomIt first, RandomIt nth, RandomIt last) {
+            using T = typename detail::real_value_type<typename std::iterator_traits<RandomIt>::value_type>::type;
+
+            if (nth == last) {
+                return;
+            }
+            detail::adaptive_order<T> order(first, last);
+            order.nth_element(std::distance(first, nth));
+            order.apply(first, last);
+        }
+    }
+}
+
+#endif // BOOST_REAL_REAL_SORT_HPP
@@ -0,0 +1,197 @@
+#ifndef BOOST_REAL_WORK_STEALING_POOL_HPP
+#define BOOST_REAL_WORK_STEALING_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief boost::real::work_stealing_pool is a fixed set of worker threads, each of them with
+         * its own queue of tasks.
+         *
+         * @details A task forked by a worker goes to the back of the worker's own queue, and the
+         * worker takes its next task from there, so nested forks are run depth first by the thread
+         * that made them. A worker whose queue is empty steals the oldest task of another queue,
+         * which is usually the largest piece of work left. A thread waiting for a forked task runs
+         * other tasks meanwhile instead of blocking, so nested fork/join never deadlocks, whatever
+         * the number of workers.
+         */
+        class work_stealing_pool {
+        public:
+            /// the result of a forked task, see fork and join
+            class task {
+                friend class work_stealing_pool;
+
+                std::atomic<bool> _done = false;
+                std::exception_ptr _exception;
+            };
+
+        private:
+            struct queue {
+                std::mutex mutex;
+                std::deque<std::function<void()>> tasks;
+            };
+
+            std::vector<std::unique_ptr<queue>> _queues;
+            std::vector<std::thread> _workers;
+            std::atomic<size_t> _pending = 0;
+            std::atomic<size_t> _next_queue = 0; // queue of the next task submitted from outside
+            bool _stop = false;
+            std::mutex _sleep_mutex;
+            std::condition_variable _wake;
+
+            // the pool and queue of the current thread, if it is a worker
+            inline static thread_local work_stealing_pool* _current_pool = nullptr;
+            inline static thread_local size_t _current_queue = 0;
+
+            void push(std::function<void()> f) {
+                size_t index = (_current_pool == this) ? _current_queue : _next_queue++ % _queues.size();
+                {
+                    std::lock_guard<std::mutex> lock(_queues[index]->mutex);
+                    _queues[index]->tasks.push_back(std::move(f));
+                }
+                _pending++;
+                {
+                    // taking the lock orders the notification after a worker checks _pending
+                    std::lock_guard<std::mutex> lock(_sleep_mutex);
+                }
+                _wake.notify_one();
+            }
+
+            bool pop(std::function<void()>& f) {
+                size_t own = (_current_pool == this) ? _current_queue : 0;
+
+                for (size_t i = 0; i < _queues.size(); i++) {
+                    queue& q = *_queues[(own + i) % _queues.size()];
+                    std::lock_guard<std::mutex> lock(q.mutex);
+                    if (q.tasks.empty()) {
+                        continue;
+                    }
+                    // the own queue is a stack, the others are robbed from the opposite end
+                    if (i == 0 && _current_pool == this) {
+                        f = std::move(q.tasks.back());
+                        q.tasks.pop_back();
+                    } else {
+                        f = std::move(q.tasks.front());
+                        q.tasks.pop_front();
+                    }
+                    _pending--;
+                    return true;
+                }
+                return false;
+            }
+
+            void work(size_t index) {
+                _current_pool = this;
+                _current_queue = index;
+
+                while (true) {
+                    if (run_one()) {
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_sleep_mutex);
+                    _wake.wait(lock, [this] { return _stop || _pending > 0; });
+                    if (_stop && _pending == 0) {
+                        return;
+                    }
+                }
+            }
+
+        public:
+            /**
+             * @brief starts a pool of threads workers.
+             *
+             * @param threads - the number of worker threads, at least one.
+             */
+            explicit work_stealing_pool(size_t threads = std::thread::hardware_concurrency()) {
+                threads = std::max<size_t>(threads, 1);
+                for (size_t i = 0; i < threads; i++) {
+                    _queues.push_back(std::make_unique<queue>());
+                }
+                for (size_t i = 0; i < threads; i++) {
+                    _workers.emplace_back([this, i] { work(i); });
+                }
+            }
+
+            work_stealing_pool(const work_stealing_pool&) = delete;
+            work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+            /// runs the pending tasks and joins the workers
+            ~work_stealing_pool() {
+                {
+                    std::lock_guard<std::mutex> lock(_sleep_mutex);
+                    _stop = true;
+                }
+                _wake.notify_all();
+                for (auto& worker : _workers) {
+                    worker.join();
+                }
+            }
+
+            size_t size() const {
+                return _workers.size();
+            }
+
+            /// queues f, to be run by any worker
+            void submit(std::function<void()> f) {
+                push(std::move(f));
+            }
+
+            /**
+             * @brief queues f and returns the task to join to wait for it.
+             *
+             * @warning f may run on any thread, so whatever it refers to must outlive the join.
+             */
+            std::shared_ptr<task> fork(std::function<void()> f) {
+                auto t = std::make_shared<task>();
+                push([t, f = std::move(f)] {
+                    try {
+                        f();
+                    } catch (...) {
+                        t->_exception = std::current_exception();
+                    }
+                    t->_done = true;
+                });
+                return t;
+            }
+
+            /**
+             * @brief waits for the forked task t, running other tasks meanwhile.
+             *
+             * @throws whatever the task threw.
+             */
+            void join(const std::shared_ptr<task>& t) {
+                while (!t->_done) {
+                    if (!run_one()) {
+                        std::this_thread::yield();
+                    }
+                }
+                if (t->_exception) {
+                    std::rethrow_exception(t->_exception);
+                }
+            }
+
+            /// runs one queued task, if there is any. Returns false if there was none.
+            bool run_one() {
+                std::function<void()> f;
+                if (!pop(f)) {
+                    return false;
+                }
+                f();
+                return true;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_WORK_STEALING_POOL_HPP
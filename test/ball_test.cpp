@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <real/ball.hpp>
+#include <real/compiled_real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("boost::real::ball arithmetic", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using ball = boost::real::ball<TestType>;
+    using exact_number = boost::real::exact_number<TestType>;
+
+    auto contains = [](const boost::real::interval<TestType>& outer, const boost::real::interval<TestType>& inner) {
+        return outer.lower_bound <= inner.lower_bound && inner.upper_bound <= outer.upper_bound;
+    };
+
+    SECTION("Magnitudes are upper bounds") {
+        boost::real::magnitude a(3, 2);
+        boost::real::magnitude b(0xFFFFFFFFFF, 0);
+        boost::real::magnitude c(3, -2);
+
+        CHECK(b.mantissa < boost::real::magnitude::MAXIMUM_MANTISSA);
+        CHECK(ball::upper_bound_of(a) >= ball::exact_integer(12));
+        CHECK(ball::upper_bound_of(b) >= ball::exact_integer(0xFFFFFFFFFF));
+        CHECK(ball::upper_bound_of(a * b) >= ball::exact_integer(12 * 0xFFFFFFFFFF));
+        CHECK(ball::upper_bound_of(a + b) >= ball::exact_integer(12 + 0xFFFFFFFFFF));
+        CHECK(ball::upper_bound_of(c) * ball::exact_integer(4) >= ball::exact_integer(3));
+    }
+
+    SECTION("Exact balls stay exact") {
+        exact_number lhs = ball::exact_integer(123456789);
+        exact_number rhs = ball::exact_integer(987654321);
+        rhs.positive = false;
+
+        auto product = boost::real::ball_multiply(ball(lhs, {}), ball(rhs, {}), 10);
+        CHECK(product.radius.is_zero());
+        CHECK(product.as_interval().is_a_number());
+        CHECK(product.midpoint == lhs * rhs);
+    }
+
+    SECTION("Balls enclose the intervals they come from") {
+        real x("1.23456789123456789123456789");
+        auto itr = x.get_real_itr().cbegin();
+        ++itr;
+
+        CHECK(contains(ball(itr.get_interval()).as_interval(), itr.get_interval()));
+    }
+
+    SECTION("The ball tape encloses the interval tape") {
+        real a("1.23456789123456789123456789");
+        real b("-2.5");
+        real c("3");
+        real result = (a * b + c) * a - b / c;
+
+        boost::real::compiled_real<TestType> tape(result);
+
+        for (size_t p = 2; p < 6; p++) {
+            auto exact = tape.evaluate(p);
+            auto enclosure = tape.evaluate_ball(p).as_interval();
+            CHECK(enclosure.lower_bound <= exact.upper_bound);
+            CHECK(exact.lower_bound <= enclosure.upper_bound);
+        }
+
+        // and it converges to the value of the number
+        auto enclosure = tape.evaluate_ball(tape.maximum_precision()).as_interval();
+        CHECK(enclosure.lower_bound <= result.get_real_itr().cend().get_interval().upper_bound);
+        CHECK(result.get_real_itr().cend().get_interval().lower_bound <= enclosure.upper_bound);
+        // the width is less than 2^-30
+        CHECK(ball::magnitude_of(enclosure.upper_bound - enclosure.lower_bound).exponent < -62);
+    }
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch.hpp>
+
+#include <real/binary_splitting.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Binary splitting of series", "[template]", int, long, long long) {
+    using boost::real::exact_number;
+    using boost::real::integer_exact;
+
+    SECTION("Integers") {
+        CHECK(integer_exact<TestType>(0) == exact_number<TestType>());
+        CHECK(integer_exact<TestType>(7) == exact_number<TestType>(std::vector<TestType> {7}));
+        CHECK(integer_exact<TestType>(-7) == exact_number<TestType>(std::vector<TestType> {7}, 1, false));
+        CHECK(integer_exact<TestType>(10939058860032000) * integer_exact<TestType>(24) ==
+              integer_exact<TestType>(640320) * integer_exact<TestType>(640320) * integer_exact<TestType>(640320));
+    }
+
+    SECTION("A number as a fraction") {
+        exact_number<TestType> x(std::vector<TestType> {3, 1, 4}, 1);
+        auto [numerator, denominator] = boost::real::as_fraction(x);
+        CHECK(numerator == exact_number<TestType>(std::vector<TestType> {3, 1, 4}));
+        CHECK(numerator == x * denominator);
+    }
+
+    SECTION("The sum of 1/k! for k = 0 to 5") {
+        // the terms k * (1 / k!) for k = 1 to 6
+        auto terms = boost::real::binary_splitting<TestType>(1, 7,
+            [](size_t) { return integer_exact<TestType>(1); },
+            [](size_t k) { return integer_exact<TestType>(k); },
+            [](size_t k) { return integer_exact<TestType>(k); });
+        CHECK(terms.p == integer_exact<TestType>(1));
+        CHECK(terms.q == integer_exact<TestType>(720));
+        CHECK(terms.t == integer_exact<TestType>(1956)); // 720 * 163/60
+
+        exact_number<TestType> lower = boost::real::split_sum(terms, 3, false);
+        exact_number<TestType> upper = boost::real::split_sum(terms, 3, true);
+        CHECK(lower * integer_exact<TestType>(60) <= integer_exact<TestType>(163));
+        CHECK(integer_exact<TestType>(163) <= upper * integer_exact<TestType>(60));
+        CHECK(upper - lower <= exact_number<TestType>(std::vector<TestType> {1}, -1));
+    }
+
+    SECTION("A resumed series splits only its new terms") {
+        auto p = [](size_t) { return integer_exact<TestType>(1); };
+        auto q = [](size_t k) { return integer_exact<TestType>(k + 1); };
+        boost::real::resumable_series<TestType> series(p, q, p);
+        series.terms(3);
+        auto resumed = series.terms(7);
+        auto whole = boost::real::binary_splitting<TestType>(0, 7, p, q, p);
+        CHECK(resumed.p == whole.p);
+        CHECK(resumed.q == whole.q);
+        CHECK(resumed.t == whole.t);
+        CHECK(series.terms(5).q == whole.q);
+    }
+
+    SECTION("Negative sums are rounded in the right direction") {
+        // -1/3
+        boost::real::split_terms<TestType> terms{integer_exact<TestType>(1), integer_exact<TestType>(3), integer_exact<TestType>(-1)};
+        exact_number<TestType> lower = boost::real::split_sum(terms, 3, false);
+        exact_number<TestType> upper = boost::real::split_sum(terms, 3, true);
+        CHECK(lower * integer_exact<TestType>(3) <= integer_exact<TestType>(-1));
+        CHECK(integer_exact<TestType>(-1) <= upper * integer_exact<TestType>(3));
+    }
+}
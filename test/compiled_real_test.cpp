@@ -0,0 +1,76 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <real/compiled_real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("boost::real::compiled_real evaluation", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using compiled_real = boost::real::compiled_real<TestType>;
+
+    SECTION("The tape matches the precision iterator") {
+        real a("1234567891011121314");
+        real b("2.5");
+        real c("-98765432109876543210");
+        real d("7");
+        real result = (a * b + c) / d - a;
+
+        compiled_real tape(result);
+        auto result_it = result.get_real_itr().cbegin();
+
+        for (size_t p = 1; p < 6; p++) {
+            CHECK(tape.evaluate(p) == result_it.get_interval());
+            ++result_it;
+        }
+    }
+
+    SECTION("Shared subexpressions are compiled once") {
+        real a("3");
+        real b("4");
+        real square = a * b;
+        real result = square + square;
+
+        compiled_real tape(result);
+
+        // a, b, a * b, and the sum (check_and_distribute turns x + x into 2 * x)
+        CHECK(tape.size() == 5);
+        CHECK(tape.evaluate().lower_bound.as_string() == "24");
+    }
+
+    SECTION("Leaves can be replaced") {
+        real a("3");
+        real b("4");
+        real c("5");
+        real result = a * b + c;
+
+        compiled_real tape(result);
+        CHECK(tape.leaves() == 3);
+        CHECK(tape.evaluate().lower_bound.as_string() == "17");
+
+        tape.set_leaf(2, real("10"));
+        CHECK(tape.evaluate().lower_bound.as_string() == "22");
+    }
+
+    SECTION("Non compiled operations are evaluated as leaves") {
+        real a("0.5");
+        real result = real::tan(a) * real("2");
+
+        compiled_real tape(result);
+        auto result_it = result.get_real_itr().cend();
+        auto& approximation = tape.evaluate(result_it.get_precision());
+
+        CHECK(approximation.lower_bound <= result_it.get_interval().upper_bound);
+        CHECK(result_it.get_interval().lower_bound <= approximation.upper_bound);
+    }
+
+    SECTION("Division by an interval containing zero at that precision throws") {
+        real one("1");
+        real three("3");
+        real tiny("0.000000000000000000000000000001");
+        // (1 / 3) * 3 - 1 + tiny straddles zero until the precision is enough to see tiny
+        real result = one / ((one / three) * three - one + tiny);
+
+        compiled_real tape(result);
+        CHECK_THROWS_AS(tape.evaluate(1), boost::real::divergent_division_result_exception);
+    }
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <real/parallel_evaluator.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("boost::real::evaluation_context", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using context = boost::real::evaluation_context;
+
+    real third = real("1") / real("3");
+    // 0.333...3 with 400 threes, which only separates from 1/3 past the default maximum precision
+    real close = real("0." + std::string(400, '3'));
+
+    SECTION("The context of the current thread gives the maximum precision") {
+        const size_t default_precision = real("1").maximum_precision();
+
+        context outer{30};
+        context inner{20};
+        {
+            context::scope outer_scope(outer);
+            CHECK(real("1").maximum_precision() == 30);
+            {
+                context::scope inner_scope(inner);
+                CHECK(real("1").maximum_precision() == 20);
+            }
+            CHECK(real("1").maximum_precision() == 30);
+
+            real own("1");
+            own.set_maximum_precision(5);
+            CHECK(own.maximum_precision() == 5);
+        }
+        CHECK(real("1").maximum_precision() == default_precision);
+    }
+
+    SECTION("Each thread has its own context") {
+        size_t seen = 0;
+        std::thread other([&seen] {
+            context c{40};
+            context::scope scope(c);
+            seen = real("1").maximum_precision();
+        });
+
+        context c{15};
+        context::scope scope(c);
+        other.join();
+        CHECK(seen == 40);
+        CHECK(real("1").maximum_precision() == 15);
+    }
+
+    SECTION("Comparisons with a context") {
+        CHECK_THROWS_AS(third.compare(close), boost::real::precision_exception);
+        CHECK(third.compare(close, context{60}) == boost::real::ORDERING::GREATER);
+        CHECK(third.compare(close, context{60, boost::real::REFINEMENT::DOUBLING}) == boost::real::ORDERING::GREATER);
+        CHECK(close.compare(third, context{60, boost::real::REFINEMENT::DOUBLING}) == boost::real::ORDERING::LESS);
+    }
+
+    SECTION("cend() and printing with a context") {
+        auto it = third.get_real_itr().cbegin().cend(context{25});
+        CHECK(it.get_precision() == 25);
+
+        std::stringstream with_context, with_scope;
+        third.print(with_context, context{25});
+        {
+            context c{25};
+            context::scope scope(c);
+            with_scope << third;
+        }
+        CHECK(with_context.str() == with_scope.str());
+    }
+
+    SECTION("The parallel evaluator runs with the context of its caller") {
+        context c{30, boost::real::REFINEMENT::LINEAR, std::make_shared<boost::real::work_stealing_pool>(2)};
+        boost::real::parallel_evaluator<TestType> e(c, 1);
+
+        real sum = third + close;
+        context::scope scope(c);
+        e.evaluate(sum);
+        CHECK(sum.get_real_itr().get_precision() == 30);
+    }
+}
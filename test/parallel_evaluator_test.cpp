@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <real/parallel_evaluator.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("boost::real::work_stealing_pool") {
+    boost::real::work_stealing_pool pool(4);
+
+    SECTION("Forked tasks are joined") {
+        std::atomic<int> count = 0;
+        std::vector<std::shared_ptr<boost::real::work_stealing_pool::task>> tasks;
+        for (int i = 0; i < 100; i++) {
+            tasks.push_back(pool.fork([&count] { count++; }));
+        }
+        for (auto& task : tasks) {
+            pool.join(task);
+        }
+        CHECK(count == 100);
+    }
+
+    SECTION("Nested forks do not deadlock") {
+        std::function<int(int)> fibonacci = [&](int n) {
+            if (n < 2) {
+                return n;
+            }
+            int a;
+            auto task = pool.fork([&] { a = fibonacci(n - 1); });
+            int b = fibonacci(n - 2);
+            pool.join(task);
+            return a + b;
+        };
+        CHECK(fibonacci(15) == 610);
+    }
+
+    SECTION("Exceptions are thrown by join") {
+        auto task = pool.fork([] { throw boost::real::precision_exception(); });
+        CHECK_THROWS_AS(pool.join(task), boost::real::precision_exception);
+    }
+}
+
+TEMPLATE_TEST_CASE("boost::real::parallel_evaluator", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using evaluator = boost::real::parallel_evaluator<TestType>;
+
+    auto sum_of_thirds = [](int terms) {
+        std::vector<real> thirds;
+        for (int i = 1; i <= terms; i++) {
+            thirds.push_back(real(std::to_string(i)) / real("3"));
+        }
+        real sum = thirds[0];
+        for (int i = 1; i < terms; i++) {
+            sum += thirds[i];
+        }
+        sum.rebalance();
+        return sum;
+    };
+
+    SECTION("The result is the same as the sequential one") {
+        real parallel = sum_of_thirds(64);
+        real sequential = sum_of_thirds(64);
+
+        evaluator e(4, 8);
+        auto result = e.evaluate(parallel, 5);
+
+        auto it = sequential.get_real_itr().cbegin();
+        it.iterate_n_times(4);
+        CHECK(result == it.get_interval());
+        CHECK(parallel.get_real_itr().get_precision() == 5);
+        CHECK(parallel > real("693.33"));
+        CHECK(parallel < real("693.34"));
+    }
+
+    SECTION("Shared subexpressions are evaluated sequentially") {
+        real third = real("1") / real("3");
+        real x = third * third + third;
+        real y = x * x + x * third;
+
+        evaluator e(4, 1);
+        e.evaluate(y, 4);
+        CHECK(y > real("0.3456"));
+        CHECK(y < real("0.3457"));
+    }
+}
@@ -0,0 +1,64 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Asynchronous evaluation of boost::real::real", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using boost::real::ORDERING;
+
+    real third = real("1") / real("3");
+    real x = third * third + third; // 4/9
+
+    SECTION("evaluate_async reaches the requested precision") {
+        auto expected = (third * third + third).get_real_itr().cbegin();
+        expected.iterate_n_times(5);
+
+        auto future = x.evaluate_async(6);
+        CHECK(future.get() == expected.get_interval());
+        CHECK(x.get_real_itr().get_precision() == 6);
+    }
+
+    SECTION("The intervals are observed as they tighten") {
+        std::mutex mutex;
+        std::vector<size_t> precisions;
+        auto future = x.evaluate_async(6, [&](const boost::real::interval<TestType>&, size_t precision) {
+            std::lock_guard<std::mutex> lock(mutex);
+            precisions.push_back(precision);
+        });
+        future.wait();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        REQUIRE(!precisions.empty());
+        CHECK(precisions.back() == 6);
+        CHECK(std::is_sorted(precisions.begin(), precisions.end()));
+    }
+
+    SECTION("Comparisons run on a pool") {
+        auto pool = std::make_shared<boost::real::work_stealing_pool>(2);
+        auto executor = boost::real::pool_executor(pool);
+
+        auto greater = x.compare_async(real("0.4444"), executor);
+        auto less = x.compare_async(real("0.4445"), executor);
+        CHECK(greater.get() == ORDERING::GREATER);
+        CHECK(less.get() == ORDERING::LESS);
+
+        auto undecided = (third * real("3")).compare_async(real("1"), executor);
+        CHECK_THROWS_AS(undecided.get(), boost::real::precision_exception);
+    }
+
+    SECTION("The caller's context is used") {
+        boost::real::evaluation_context context{20};
+        std::future<boost::real::interval<TestType>> future;
+        {
+            boost::real::evaluation_context::scope scope(context);
+            future = x.evaluate_async(50);
+        }
+        future.wait();
+        CHECK(x.get_real_itr().get_precision() == 20);
+    }
+}
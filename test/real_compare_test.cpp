@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+
+#include <sstream>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Three-way comparison of boost::real::real", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using boost::real::ORDERING;
+    using boost::real::TYPE;
+
+    SECTION("Explicit numbers") {
+        real a("1.5");
+        real b("-2.25");
+        real c("1.50");
+
+        CHECK(a.compare(b) == ORDERING::GREATER);
+        CHECK(b.compare(a) == ORDERING::LESS);
+        CHECK(a.compare(c) == ORDERING::EQUAL);
+        CHECK(a.compare(a) == ORDERING::EQUAL);
+        CHECK(a != b);
+        CHECK(a <= c);
+        CHECK(a >= c);
+    }
+
+    SECTION("Operations are refined until they separate") {
+        real third = real("1") / real("3");
+        real almost_third("0.333333333333333333333333333333333");
+
+        CHECK(third.compare(almost_third) == ORDERING::GREATER);
+        CHECK(almost_third < third);
+    }
+
+    SECTION("Overlapping numbers throw at the maximum precision") {
+        real one("1");
+        real three("3");
+        real third = one / three;
+
+        CHECK_THROWS_AS(third * three == one, boost::real::precision_exception);
+    }
+
+    SECTION("Rational numbers compare exactly") {
+        real half("1/2", TYPE::RATIONAL);
+        real minus_third("-1/3", TYPE::RATIONAL);
+
+        CHECK(half.compare(real("0.5")) == ORDERING::EQUAL);
+        CHECK(real("0.5") == half);
+        CHECK(minus_third.compare(real("-0.5")) == ORDERING::GREATER);
+        CHECK(real("-0.3") > minus_third);
+        CHECK(minus_third < half);
+        CHECK(real("-2", TYPE::RATIONAL).compare(real("-4/2", TYPE::RATIONAL)) == ORDERING::EQUAL);
+    }
+
+    SECTION("Approximations are kept in the nodes") {
+        real third = real("1") / real("3");
+        real almost_third("0.333333333333333333333333333333333");
+
+        CHECK(third > almost_third);
+        auto precision = third.get_real_itr().get_precision();
+        CHECK(precision > 1);
+
+        // comparing again starts from the precision already reached
+        CHECK(third > almost_third);
+        CHECK(third.get_real_itr().get_precision() == precision);
+
+        std::stringstream printed;
+        printed << third;
+        CHECK(third.get_real_itr().get_precision() == third.maximum_precision());
+    }
+
+    SECTION("Budgeted comparisons are undecided when the budget runs out") {
+        using boost::real::BUDGET_STATUS;
+        real one("1");
+        real three("3");
+        real third = one / three;
+
+        boost::real::evaluation_budget budget;
+        budget.refinements = 3;
+        auto undecided = (third * three).compare(one, budget);
+        CHECK(undecided.status == BUDGET_STATUS::UNDECIDED);
+        CHECK(undecided.this_approximation.lower_bound < undecided.this_approximation.upper_bound);
+
+        auto decided = third.compare(real("0.3333"), budget);
+        CHECK(decided.status == BUDGET_STATUS::DECIDED);
+        CHECK(decided.ordering == ORDERING::GREATER);
+        CHECK(real("0.3333").compare(third, budget).ordering == ORDERING::LESS);
+
+        budget.refinements.reset();
+        budget.time = std::chrono::milliseconds(0);
+        CHECK((third * three).compare(one, budget).status == BUDGET_STATUS::UNDECIDED);
+
+        auto evaluation = (third * three).evaluate(8, budget);
+        CHECK(evaluation.status == BUDGET_STATUS::UNDECIDED);
+        CHECK(evaluation.precision < 8);
+        evaluation = (third * three).evaluate(8);
+        CHECK(evaluation.status == BUDGET_STATUS::DECIDED);
+        CHECK(evaluation.precision == 8);
+    }
+
+    SECTION("Minimum and maximum") {
+        real a("1.5");
+        real b("-2.25");
+
+        CHECK(real::min(a, b) == b);
+        CHECK(real::max(a, b) == a);
+        CHECK(real::min(a, a) == a);
+    }
+}
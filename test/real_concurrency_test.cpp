@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Concurrent evaluation of shared boost::real::real numbers", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    const int threads = 8;
+
+    real third = real("1") / real("3");
+    real shared = third * third + third; // 4/9
+
+    SECTION("Numbers sharing a subtree are compared from several threads") {
+        std::atomic<int> correct = 0;
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threads; i++) {
+            workers.emplace_back([&shared, &correct, i] {
+                real x = shared + real(std::to_string(i));
+                if (x > real(std::to_string(i) + ".4444") && x < real(std::to_string(i) + ".4445")) {
+                    correct++;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        CHECK(correct == threads);
+    }
+
+    SECTION("The same number is printed from several threads") {
+        std::vector<std::string> printed(threads);
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threads; i++) {
+            workers.emplace_back([&shared, &printed, i] {
+                std::stringstream ss;
+                ss << shared;
+                printed[i] = ss.str();
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        std::stringstream expected;
+        expected << shared;
+        for (const auto& p : printed) {
+            CHECK(p == expected.str());
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <real/real_expression.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("boost::real expression templates", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using boost::real::expr;
+
+    real a("1.5");
+    real b("-2.25");
+    real c("1234567891011121314");
+    real d("3");
+
+    SECTION("The approximation matches the precision iterator") {
+        auto e = (expr(a) * b + c * d) / d - a;
+        real result = (a * b + c * d) / d - a;
+        auto result_it = result.get_real_itr().cbegin();
+
+        for (size_t p = 1; p < 6; p++) {
+            CHECK(e.approximate(p) == result_it.get_interval());
+            ++result_it;
+        }
+    }
+
+    SECTION("Materialized expressions are reals") {
+        real result = expr(a) * b + c * d;
+
+        CHECK(result == a * b + c * d);
+        CHECK(std::holds_alternative<boost::real::real_operation<TestType>>(result.get_real_number()));
+    }
+
+    SECTION("Materialized expressions are not simplified") {
+        // real::operator+ rewrites a + a into 2 * a, the expression keeps the addition
+        real result = expr(a) + a;
+        auto& op = std::get<boost::real::real_operation<TestType>>(result.get_real_number());
+
+        CHECK(op.get_operation() == boost::real::OPERATION::ADDITION);
+        CHECK(op.lhs() == op.rhs());
+        CHECK(result == real("3"));
+    }
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Hash-consing of boost::real::real nodes", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using node_table = boost::real::real_node_table<TestType>;
+
+    SECTION("Disabled by default") {
+        real a("123");
+        real b("123");
+
+        CHECK(&a.get_real_number() != &b.get_real_number());
+        CHECK(node_table::size() == 0);
+    }
+
+    node_table::enabled = true;
+
+    SECTION("Equal leaves are shared") {
+        real a("123");
+        real b("123");
+        real c("124");
+
+        CHECK(&a.get_real_number() == &b.get_real_number());
+        CHECK(&a.get_real_number() != &c.get_real_number());
+    }
+
+    SECTION("Equal operations are shared") {
+        real x1("1.5");
+        real x2("1.5");
+        real y("2");
+
+        real a = x1 * x1;
+        real b = x2 * x2;
+        real c = x1 * y;
+
+        CHECK(&x1.get_real_number() == &x2.get_real_number());
+        CHECK(&a.get_real_number() == &b.get_real_number());
+        CHECK(&a.get_real_number() != &c.get_real_number());
+    }
+
+    SECTION("Shared nodes evaluate to the same value") {
+        real x1("1.5");
+        real x2("1.5");
+
+        real result = x1 * x1 + x2 * x2;
+
+        CHECK(result > real("4.49"));
+        CHECK(result < real("4.51"));
+    }
+
+    SECTION("Expired nodes are not reused") {
+        {
+            real a("98765");
+        }
+        real b("98765");
+        real c("98765");
+
+        CHECK(&b.get_real_number() == &c.get_real_number());
+        CHECK(b.get_real_itr().cend().get_interval().lower_bound.as_string() == "98765");
+    }
+
+    node_table::enabled = false;
+    node_table::clear();
+}
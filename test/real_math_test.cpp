@@ -60,6 +60,46 @@ TEST_CASE("TRIGONOMETRIC FUNCTIONS"){
 		
 	}
 
+	SECTION("LARGE ARGUMENTS"){
+		real a("1000000");
+		real b = real::sin(a); // sin(1000000) = -0.349993502171292952
+		CHECK(b > real("-0.349993502171292953"));
+		CHECK(b < real("-0.349993502171292952"));
+
+		b = real::cos(a); // cos(1000000) = 0.936752127533144786
+		CHECK(b > real("0.936752127533144786"));
+		CHECK(b < real("0.936752127533144787"));
+
+		a = real("10000000000000000000000");
+		b = real::cos(a); // cos(1e22) = 0.523214785395138945
+		CHECK(b > real("0.523214785395138945"));
+		CHECK(b < real("0.523214785395138946"));
+
+		a = real("-123456.789");
+		b = real::sin(a); // sin(-123456.789) = 0.998664082343447097
+		CHECK(b > real("0.998664082343447097"));
+		CHECK(b < real("0.998664082343447098"));
+	}
+
+	SECTION("SIN AND COS OF KEPT BOUNDS"){
+		using exact_number = boost::real::exact_number<int>;
+		// the same bound at growing precision, as for an operand whose digits are all known
+		exact_number x(std::vector<int> {1, 230000000}, 1);
+		boost::real::sin_cos_cache<int> cache;
+		for(size_t precision = 2; precision < 9; ++precision){
+			auto [sin_lower, cos_lower] = cache.get(x, precision, false);
+			auto [sin_upper, cos_upper] = cache.get(x, precision, true);
+			auto [sin_below, cos_below] = boost::real::sin_cos(x, precision + 2, false);
+			auto [sin_above, cos_above] = boost::real::sin_cos(x, precision + 2, true);
+			CHECK(sin_lower <= sin_above);
+			CHECK(sin_below <= sin_upper);
+			CHECK(cos_lower <= cos_above);
+			CHECK(cos_below <= cos_upper);
+			CHECK(sin_upper - sin_lower < exact_number(std::vector<int> {2}, 1 - (int)precision));
+			CHECK(cos_upper - cos_lower < exact_number(std::vector<int> {2}, 1 - (int)precision));
+		}
+	}
+
 	SECTION("ADDITION OPERATION (A+B)"){
 		real a("0.45");
 		real b("1.02");
@@ -313,6 +353,32 @@ TEST_CASE("LOGARITHM AND EXPONENT"){
 		CHECK(b < upper_limit);
 	}
 
+	SECTION("LARGE ARGUMENTS"){
+		real a("100.25");
+		real b = real::exp(a); // exp(100.25) = 3.451610733125923987e43
+		CHECK(b > real("34516107331259239870000000000000000000000000"));
+		CHECK(b < real("34516107331259239880000000000000000000000000"));
+
+		a = real("-40.125");
+		b = real::exp(a); // exp(-40.125) = 3.749159471376912762e-18
+		CHECK(b > real("0.000000000000000003749159471376912762"));
+		CHECK(b < real("0.000000000000000003749159471376912763"));
+
+		a = real("1000000000000000000000000000000");
+		b = real::log(a); // log(1e30) = 69.07755278982137052053974364053
+		CHECK(b > real("69.07755278982137052053974364053"));
+		CHECK(b < real("69.07755278982137052053974364054"));
+
+		a = real("0.00000000000000000001");
+		b = real::log(a); // log(1e-20) = -46.05170185988091368035982909368
+		CHECK(b > real("-46.05170185988091368035982909369"));
+		CHECK(b < real("-46.05170185988091368035982909368"));
+
+		b = real::log10(a);
+		CHECK(b > real("-20.0000000000000000001"));
+		CHECK(b < real("-19.9999999999999999999"));
+	}
+
 	SECTION("ADDITION OPERATION (A+B)"){
 		real a("0.5");
 		real b("1.5");
@@ -872,6 +938,25 @@ TEST_CASE("SQURE ROOT FUNCTION TEST"){
 		CHECK(result < upper_limit);
 	}
 
+	SECTION("PERFECT SQUARES ARE EXACT"){
+		CHECK(real::sqrt(real("4")) == real("2"));
+		CHECK(real::sqrt(real("0.0625")) == real("0.25"));
+		CHECK(real::sqrt(real("0")) == real("0"));
+		CHECK_THROWS_AS(real::sqrt(real("-4")), boost::real::sqrt_not_defined_for_negative_number);
+	}
+
+	SECTION("N-TH ROOTS"){
+		CHECK(real::nth_root(real("-27"), real("3")) == real("-3"));
+		CHECK(real::nth_root(real("1024"), real("10")) == real("2"));
+
+		real result = real::nth_root(real("2"), real("3")); // 1.259921049894873
+		CHECK(result > real("1.259921049894872"));
+		CHECK(result < real("1.259921049894874"));
+
+		CHECK_THROWS_AS(real::nth_root(real("-16"), real("4")), boost::real::even_root_of_negative_number);
+		CHECK_THROWS_AS(real::nth_root(real("2"), real("0")), boost::real::root_degree_out_of_range);
+	}
+
 	SECTION("NUMBER IS AN OPERATION"){
 		SECTION("ADDITION OPERATION"){
 			real a("2");
@@ -921,3 +1006,94 @@ TEST_CASE("SQURE ROOT FUNCTION TEST"){
 
 	}
 }
+
+TEST_CASE("ENCLOSURES OF NARROW INTERVALS"){
+	using exact_number = boost::real::exact_number<int>;
+	using interval = boost::real::interval<int>;
+	// [m - d, m + d], with m about 1.23 and d = base^-6, narrow enough for the mean value enclosures at precision 10
+	exact_number middle(std::vector<int> {1, 246960599}, 1);
+	exact_number d(std::vector<int> {1}, -5);
+	interval x;
+	x.lower_bound = middle - d;
+	x.upper_bound = middle + d;
+	size_t precision = 10;
+	exact_number error(std::vector<int> {4}, 1 - (int)precision);
+	exact_number slack(std::vector<int> {1, 10737418}, 1); // about 1.01
+
+	// the enclosure holds the values at the bounds, and is about as wide as they are apart
+	auto check = [&](const interval& result, const exact_number& lower, const exact_number& upper){
+		CHECK(result.lower_bound <= lower);
+		CHECK(upper <= result.upper_bound);
+		CHECK(result.upper_bound - result.lower_bound <= (upper - lower) * slack + error);
+	};
+
+	SECTION("EXPONENT"){
+		check(boost::real::interval_exponent(x, precision),
+		      boost::real::exponent(x.lower_bound, precision, false), boost::real::exponent(x.upper_bound, precision, true));
+	}
+
+	SECTION("LOGARITHM"){
+		check(boost::real::interval_logarithm(x, precision),
+		      boost::real::logarithm(x.lower_bound, precision, false), boost::real::logarithm(x.upper_bound, precision, true));
+	}
+
+	SECTION("SINE"){
+		check(boost::real::interval_sine(x, precision),
+		      boost::real::sine(x.lower_bound, precision, false), boost::real::sine(x.upper_bound, precision, true));
+	}
+
+	SECTION("COSINE"){
+		// cosine is decreasing here
+		check(boost::real::interval_cosine(x, precision),
+		      boost::real::cosine(x.upper_bound, precision, false), boost::real::cosine(x.lower_bound, precision, true));
+	}
+}
+
+
+TEST_CASE("INVERSE TRIGONOMETRIC AND HYPERBOLIC FUNCTIONS"){
+	using real = boost::real::real<int>;
+
+	// the value lies strictly between the limits
+	auto check = [](const real& value, const char* lower_limit, const char* upper_limit){
+		CHECK(value > real(lower_limit));
+		CHECK(value < real(upper_limit));
+	};
+
+	SECTION("INVERSE TRIGONOMETRIC VALUES"){
+		real zero("0");
+		CHECK(real::atan(zero) == zero);
+		CHECK(real::asin(zero) == zero);
+
+		check(real::atan(real("0.4")), "0.380506377112364", "0.380506377112366"); // atan(0.4) = 0.380506377112365
+		check(real::atan(real("1.23")), "0.888173774377679", "0.888173774377681"); // atan(1.23) = 0.888173774377680
+		check(real::atan(real("-30")), "-1.537475330916650", "-1.537475330916648"); // atan(-30) = -1.537475330916649
+		check(real::asin(real("0.5")), "0.523598775598298", "0.523598775598300"); // asin(0.5) = π/6
+		check(real::acos(real("-0.25")), "1.823476581936974", "1.823476581936976"); // acos(-0.25) = 1.823476581936975
+
+		CHECK_THROWS_AS(real::asin(real("2")), boost::real::arcsine_not_defined_outside_unit_interval);
+		CHECK_THROWS_AS(real::acos(real("-1.5")), boost::real::arcsine_not_defined_outside_unit_interval);
+	}
+
+	SECTION("HYPERBOLIC VALUES"){
+		real zero("0");
+		CHECK(real::sinh(zero) == zero);
+		CHECK(real::cosh(zero) == real("1"));
+		CHECK(real::tanh(zero) == zero);
+
+		check(real::sinh(real("1.23")), "1.564468479304406", "1.564468479304408"); // sinh(1.23) = 1.564468479304407
+		check(real::cosh(real("-2.5")), "6.132289479663685", "6.132289479663687"); // cosh(-2.5) = 6.132289479663686
+		check(real::tanh(real("0.75")), "0.635148952387286", "0.635148952387288"); // tanh(0.75) = 0.635148952387287
+	}
+
+	SECTION("INVERSES OF EACH OTHER"){
+		real a("0.3");
+		real b = real::sin(real::asin(a));
+		check(b, "0.299999999999999", "0.300000000000001");
+		b = real::tan(real::atan(a));
+		check(b, "0.299999999999999", "0.300000000000001");
+
+		// cosh^2 - sinh^2 = 1
+		real c = real::cosh(a) * real::cosh(a) - real::sinh(a) * real::sinh(a);
+		check(c, "0.999999999999999", "1.000000000000001");
+	}
+}
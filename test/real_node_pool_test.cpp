@@ -0,0 +1,52 @@
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("boost::real node pool", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+    using allocator = boost::real::pool_allocator<boost::real::real_data<TestType>>;
+
+    SECTION("Freed blocks are reused") {
+        allocator pool;
+        auto first = pool.allocate(1);
+        pool.deallocate(first, 1);
+        auto second = pool.allocate(1);
+
+        CHECK(first == second);
+        pool.deallocate(second, 1);
+    }
+
+    SECTION("Nodes may be freed by another thread") {
+        std::vector<real> terms;
+        for (int i = 0; i < 1000; i++) {
+            terms.emplace_back(std::to_string(i));
+        }
+
+        real sum("0");
+        std::thread worker([&terms, &sum] {
+            for (auto& term : terms) {
+                sum += term;
+            }
+            terms.clear();
+        });
+        worker.join();
+
+        CHECK(sum == real("499500"));
+    }
+
+    SECTION("Nodes outlive the thread that created them") {
+        real sum("0");
+        std::thread worker([&sum] {
+            for (int i = 0; i < 1000; i++) {
+                sum += real(std::to_string(i));
+            }
+        });
+        worker.join();
+
+        CHECK(sum == real("499500"));
+    }
+}
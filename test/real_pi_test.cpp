@@ -248,4 +248,25 @@ TEST_CASE("Pi") {
 
 	}
 
+}
+
+TEST_CASE("Digits of pi are kept") {
+
+	auto& pi = boost::real::constants<int>::pi();
+	std::vector<int> first_digits;
+	for (size_t n = 0; n < 10; ++n) {
+		first_digits.push_back(pi.digit(n));
+	}
+	CHECK(first_digits[0] == 3);
+
+	// extending the digits does not change the ones read before
+	pi.digit(200);
+	for (size_t n = 0; n < 10; ++n) {
+		CHECK(pi.digit(n) == first_digits[n]);
+	}
+	CHECK(boost::real::constants<int>::pi().get(3, false) <= boost::real::constants<int>::pi().get(3, true));
+
+	// the digits go past the 300 decimal digits of the literal that 426880 sqrt(10005) used to be
+	CHECK(pi.digit(40) == 934551531);
+	CHECK(pi.digit(100) == 396281177);
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Rebalancing of boost::real::real operation chains", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+
+    // decimal literals are divisions of two integers, so each term adds one level to the depth
+
+    SECTION("Additions are rebalanced") {
+        real sum("0.5");
+        for (int i = 1; i < 64; i++) {
+            sum += real(std::to_string(i) + ".5");
+        }
+        CHECK(sum.depth() == 64);
+
+        sum.rebalance();
+        CHECK(sum.depth() == 7);
+        CHECK(sum == real("2048"));
+    }
+
+    SECTION("Subtracted terms are kept") {
+        real result("10");
+        for (int i = 1; i < 16; i++) {
+            result -= real("1.5");
+            result += real("0.25");
+        }
+        CHECK(result.depth() == 31);
+
+        result.rebalance();
+        CHECK(result.depth() <= 7);
+        CHECK(result == real("-8.75"));
+    }
+
+    SECTION("Multiplications are rebalanced") {
+        real product("1.5");
+        for (int i = 1; i < 16; i++) {
+            product *= real("1.5");
+        }
+        CHECK(product.depth() == 16);
+
+        product.rebalance();
+        CHECK(product.depth() == 5);
+        CHECK(product > real("656.8"));
+        CHECK(product < real("656.9"));
+    }
+
+    SECTION("Chains are rebalanced automatically past rebalance_depth") {
+        real::rebalance_depth = 8;
+
+        real sum("0.5");
+        for (int i = 1; i < 100; i++) {
+            sum += real("1.5");
+            CHECK(sum.depth() <= 8);
+        }
+        CHECK(sum == real("149"));
+
+        real::rebalance_depth.reset();
+    }
+}
@@ -0,0 +1,58 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/real_sort.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Adaptive sort of boost::real::real numbers", "[template]", int, long, long long) {
+    using real = boost::real::real<TestType>;
+
+    real one("1");
+    real third = one / real("3");
+    real seventh = one / real("7");
+
+    std::vector<real> numbers = {
+        real("0.5"),
+        third,
+        real("-2"),
+        seventh * real("7") - real("2"),          // -1, not exact
+        real("0.333333333333333333333333"),
+        third,
+        seventh,
+        real("-1.5"),
+        real("0.142857142857142857"),
+    };
+
+    SECTION("Sort") {
+        boost::real::sort(numbers.begin(), numbers.end());
+
+        for (size_t i = 1; i < numbers.size(); i++) {
+            CHECK_FALSE(numbers[i] < numbers[i - 1]);
+        }
+        CHECK(numbers.front() == real("-2"));
+        CHECK(numbers.back() == real("0.5"));
+        // copies of the same number stay together
+        CHECK(&numbers[6].get_real_number() == &third.get_real_number());
+        CHECK(&numbers[7].get_real_number() == &third.get_real_number());
+    }
+
+    SECTION("nth_element") {
+        auto nth = numbers.begin() + 4;
+        boost::real::nth_element(numbers.begin(), nth, numbers.end());
+
+        CHECK(nth->compare(seventh) == boost::real::ORDERING::EQUAL);
+        for (auto it = numbers.begin(); it != nth; ++it) {
+            CHECK(*it < *nth);
+        }
+        for (auto it = nth + 1; it != numbers.end(); ++it) {
+            CHECK(*nth < *it);
+        }
+    }
+
+    SECTION("Numbers that can't be separated throw") {
+        std::vector<real> overlapping = {third * real("3"), one};
+        CHECK_THROWS_AS(boost::real::sort(overlapping.begin(), overlapping.end()), boost::real::precision_exception);
+    }
+}